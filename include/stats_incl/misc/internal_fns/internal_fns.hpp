@@ -21,10 +21,17 @@
 #ifndef _statslib_internal_fns_HPP
 #define _statslib_internal_fns_HPP
 
+#include "math_dispatch.hpp"
+
 #include "log_if.hpp"
 #include "exp_if.hpp"
 
+#include "rand_bits.hpp"
 #include "seed_values.hpp"
 #include "statslib_defs.hpp"
+#include "omp_cost.hpp"
+#include "thread_pool.hpp"
+#include "omp_sched.hpp"
+#include "rand_fill.hpp"
 
 #endif
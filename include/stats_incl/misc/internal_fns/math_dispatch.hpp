@@ -0,0 +1,171 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * math functions with compile-time/run-time dispatch:
+ * GCEM is used during constant evaluation and the standard library otherwise
+ */
+
+#ifndef _statslib_math_dispatch_HPP
+#define _statslib_math_dispatch_HPP
+
+namespace math
+{
+
+#ifdef STATS_USE_STD_MATH
+    #define STATS_MATH_DISPATCH(fn_name, ...) ( STATS_IS_CONSTANT_EVALUATED() ? gcem::fn_name(__VA_ARGS__) : std::fn_name(__VA_ARGS__) )
+#else
+    #define STATS_MATH_DISPATCH(fn_name, ...) gcem::fn_name(__VA_ARGS__)
+#endif
+
+//
+// trivial functions: no dispatch needed
+
+template<typename T>
+statslib_constexpr
+T
+abs(const T x)
+noexcept
+{
+    return gcem::abs(x);
+}
+
+template<typename T1, typename T2>
+statslib_constexpr
+common_t<T1,T2>
+max(const T1 x, const T2 y)
+noexcept
+{
+    return gcem::max(x,y);
+}
+
+//
+// transcendental functions
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+exp(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(exp,x);
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+expm1(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(expm1,x);
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+log(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(log,x);
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+log1p(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(log1p,x);
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+sqrt(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(sqrt,x);
+}
+
+template<typename T1, typename T2>
+statslib_constexpr
+common_t<T1,T2>
+pow(const T1 base, const T2 exp_term)
+noexcept
+{
+#ifdef STATS_USE_STD_MATH
+    return( STATS_IS_CONSTANT_EVALUATED() ? \
+                gcem::pow(base,exp_term) :
+                static_cast<common_t<T1,T2>>(std::pow(base,exp_term)) );
+#else
+    return gcem::pow(base,exp_term);
+#endif
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+lgamma(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(lgamma,x);
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+erf(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(erf,x);
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+tan(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(tan,x);
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+atan(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(atan,x);
+}
+
+template<typename T>
+statslib_constexpr
+return_t<T>
+tanh(const T x)
+noexcept
+{
+    return STATS_MATH_DISPATCH(tanh,x);
+}
+
+}
+
+#undef STATS_MATH_DISPATCH
+
+#endif
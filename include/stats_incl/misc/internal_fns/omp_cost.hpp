@@ -0,0 +1,369 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * estimated cost per element of each vectorized kernel, used to size OpenMP work
+ */
+
+#ifndef _statslib_omp_cost_HPP
+#define _statslib_omp_cost_HPP
+
+// nanoseconds per element, for double-precision input and output, measured serially by tests/bench/omp_cost.cpp
+// (GCC, -O3 -march=native, x86-64). Costs depend on the parameter values and the machine; only their order of
+// magnitude matters. Any entry may be replaced by defining it before including StatsLib.
+
+// density functions
+
+#ifndef STATS_OMP_COST_dbern
+    #define STATS_OMP_COST_dbern ullint_t(11)
+#endif
+
+#ifndef STATS_OMP_COST_dbeta
+    #define STATS_OMP_COST_dbeta ullint_t(59)
+#endif
+
+#ifndef STATS_OMP_COST_dbinom
+    #define STATS_OMP_COST_dbinom ullint_t(1467)
+#endif
+
+#ifndef STATS_OMP_COST_dcauchy
+    #define STATS_OMP_COST_dcauchy ullint_t(11)
+#endif
+
+#ifndef STATS_OMP_COST_dchisq
+    #define STATS_OMP_COST_dchisq ullint_t(29)
+#endif
+
+#ifndef STATS_OMP_COST_dexp
+    #define STATS_OMP_COST_dexp ullint_t(15)
+#endif
+
+#ifndef STATS_OMP_COST_df
+    #define STATS_OMP_COST_df ullint_t(71)
+#endif
+
+#ifndef STATS_OMP_COST_dgamma
+    #define STATS_OMP_COST_dgamma ullint_t(30)
+#endif
+
+#ifndef STATS_OMP_COST_dinvgamma
+    #define STATS_OMP_COST_dinvgamma ullint_t(30)
+#endif
+
+#ifndef STATS_OMP_COST_dinvgauss
+    #define STATS_OMP_COST_dinvgauss ullint_t(19)
+#endif
+
+#ifndef STATS_OMP_COST_dlaplace
+    #define STATS_OMP_COST_dlaplace ullint_t(16)
+#endif
+
+#ifndef STATS_OMP_COST_dlnorm
+    #define STATS_OMP_COST_dlnorm ullint_t(31)
+#endif
+
+#ifndef STATS_OMP_COST_dlogis
+    #define STATS_OMP_COST_dlogis ullint_t(27)
+#endif
+
+#ifndef STATS_OMP_COST_dnorm
+    #define STATS_OMP_COST_dnorm ullint_t(16)
+#endif
+
+#ifndef STATS_OMP_COST_dpois
+    #define STATS_OMP_COST_dpois ullint_t(28)
+#endif
+
+#ifndef STATS_OMP_COST_dradem
+    #define STATS_OMP_COST_dradem ullint_t(11)
+#endif
+
+#ifndef STATS_OMP_COST_dt
+    #define STATS_OMP_COST_dt ullint_t(70)
+#endif
+
+#ifndef STATS_OMP_COST_dunif
+    #define STATS_OMP_COST_dunif ullint_t(13)
+#endif
+
+#ifndef STATS_OMP_COST_dweibull
+    #define STATS_OMP_COST_dweibull ullint_t(27)
+#endif
+
+// distribution functions
+
+#ifndef STATS_OMP_COST_pbern
+    #define STATS_OMP_COST_pbern ullint_t(13)
+#endif
+
+#ifndef STATS_OMP_COST_pbeta
+    #define STATS_OMP_COST_pbeta ullint_t(4400)
+#endif
+
+#ifndef STATS_OMP_COST_pbinom
+    #define STATS_OMP_COST_pbinom ullint_t(7441)
+#endif
+
+#ifndef STATS_OMP_COST_pcauchy
+    #define STATS_OMP_COST_pcauchy ullint_t(22)
+#endif
+
+#ifndef STATS_OMP_COST_pchisq
+    #define STATS_OMP_COST_pchisq ullint_t(2208)
+#endif
+
+#ifndef STATS_OMP_COST_pexp
+    #define STATS_OMP_COST_pexp ullint_t(23)
+#endif
+
+#ifndef STATS_OMP_COST_pf
+    #define STATS_OMP_COST_pf ullint_t(4996)
+#endif
+
+#ifndef STATS_OMP_COST_pgamma
+    #define STATS_OMP_COST_pgamma ullint_t(1898)
+#endif
+
+#ifndef STATS_OMP_COST_pinvgamma
+    #define STATS_OMP_COST_pinvgamma ullint_t(1744)
+#endif
+
+#ifndef STATS_OMP_COST_pinvgauss
+    #define STATS_OMP_COST_pinvgauss ullint_t(310)
+#endif
+
+#ifndef STATS_OMP_COST_plaplace
+    #define STATS_OMP_COST_plaplace ullint_t(17)
+#endif
+
+#ifndef STATS_OMP_COST_plnorm
+    #define STATS_OMP_COST_plnorm ullint_t(126)
+#endif
+
+#ifndef STATS_OMP_COST_plogis
+    #define STATS_OMP_COST_plogis ullint_t(20)
+#endif
+
+#ifndef STATS_OMP_COST_pnorm
+    #define STATS_OMP_COST_pnorm ullint_t(153)
+#endif
+
+#ifndef STATS_OMP_COST_ppois
+    #define STATS_OMP_COST_ppois ullint_t(201)
+#endif
+
+#ifndef STATS_OMP_COST_pradem
+    #define STATS_OMP_COST_pradem ullint_t(11)
+#endif
+
+#ifndef STATS_OMP_COST_pt
+    #define STATS_OMP_COST_pt ullint_t(5154)
+#endif
+
+#ifndef STATS_OMP_COST_punif
+    #define STATS_OMP_COST_punif ullint_t(12)
+#endif
+
+#ifndef STATS_OMP_COST_pweibull
+    #define STATS_OMP_COST_pweibull ullint_t(20)
+#endif
+
+// quantile functions
+
+#ifndef STATS_OMP_COST_qbern
+    #define STATS_OMP_COST_qbern ullint_t(11)
+#endif
+
+#ifndef STATS_OMP_COST_qbeta
+    #define STATS_OMP_COST_qbeta ullint_t(64586)
+#endif
+
+#ifndef STATS_OMP_COST_qbinom
+    #define STATS_OMP_COST_qbinom ullint_t(21490)
+#endif
+
+#ifndef STATS_OMP_COST_qcauchy
+    #define STATS_OMP_COST_qcauchy ullint_t(92)
+#endif
+
+#ifndef STATS_OMP_COST_qchisq
+    #define STATS_OMP_COST_qchisq ullint_t(57723)
+#endif
+
+#ifndef STATS_OMP_COST_qexp
+    #define STATS_OMP_COST_qexp ullint_t(17)
+#endif
+
+#ifndef STATS_OMP_COST_qf
+    #define STATS_OMP_COST_qf ullint_t(112685)
+#endif
+
+#ifndef STATS_OMP_COST_qgamma
+    #define STATS_OMP_COST_qgamma ullint_t(59126)
+#endif
+
+#ifndef STATS_OMP_COST_qinvgamma
+    #define STATS_OMP_COST_qinvgamma ullint_t(60508)
+#endif
+
+#ifndef STATS_OMP_COST_qinvgauss
+    #define STATS_OMP_COST_qinvgauss ullint_t(15685)
+#endif
+
+#ifndef STATS_OMP_COST_qlaplace
+    #define STATS_OMP_COST_qlaplace ullint_t(19)
+#endif
+
+#ifndef STATS_OMP_COST_qlnorm
+    #define STATS_OMP_COST_qlnorm ullint_t(5417)
+#endif
+
+#ifndef STATS_OMP_COST_qlogis
+    #define STATS_OMP_COST_qlogis ullint_t(20)
+#endif
+
+#ifndef STATS_OMP_COST_qnorm
+    #define STATS_OMP_COST_qnorm ullint_t(5436)
+#endif
+
+#ifndef STATS_OMP_COST_qpois
+    #define STATS_OMP_COST_qpois ullint_t(203)
+#endif
+
+#ifndef STATS_OMP_COST_qradem
+    #define STATS_OMP_COST_qradem ullint_t(12)
+#endif
+
+#ifndef STATS_OMP_COST_qt
+    #define STATS_OMP_COST_qt ullint_t(5498)
+#endif
+
+#ifndef STATS_OMP_COST_qunif
+    #define STATS_OMP_COST_qunif ullint_t(12)
+#endif
+
+#ifndef STATS_OMP_COST_qweibull
+    #define STATS_OMP_COST_qweibull ullint_t(52)
+#endif
+
+// random sampling: the per-draw kernel passed to RAND_DIST_FN_VEC or RAND_UNIT_FN_VEC, the block sampler, or
+// the inversion transform of a rand_mode fill
+
+#ifndef STATS_OMP_COST_rbern
+    #define STATS_OMP_COST_rbern ullint_t(17)
+#endif
+
+#ifndef STATS_OMP_COST_rbeta_draw
+    #define STATS_OMP_COST_rbeta_draw ullint_t(76)
+#endif
+
+#ifndef STATS_OMP_COST_rbinom_draw
+    #define STATS_OMP_COST_rbinom_draw ullint_t(41)
+#endif
+
+#ifndef STATS_OMP_COST_rcauchy_from_unit
+    #define STATS_OMP_COST_rcauchy_from_unit ullint_t(30)
+#endif
+
+#ifndef STATS_OMP_COST_rchisq_draw
+    #define STATS_OMP_COST_rchisq_draw ullint_t(21)
+#endif
+
+#ifndef STATS_OMP_COST_rdiscrete_draw
+    #define STATS_OMP_COST_rdiscrete_draw ullint_t(14)
+#endif
+
+#ifndef STATS_OMP_COST_rexp_from_unit
+    #define STATS_OMP_COST_rexp_from_unit ullint_t(18)
+#endif
+
+#ifndef STATS_OMP_COST_rexp_vec_compute
+    #define STATS_OMP_COST_rexp_vec_compute ullint_t(13)
+#endif
+
+#ifndef STATS_OMP_COST_rf_draw
+    #define STATS_OMP_COST_rf_draw ullint_t(73)
+#endif
+
+#ifndef STATS_OMP_COST_rgamma_draw
+    #define STATS_OMP_COST_rgamma_draw ullint_t(39)
+#endif
+
+#ifndef STATS_OMP_COST_rinvgamma
+    #define STATS_OMP_COST_rinvgamma ullint_t(39)
+#endif
+
+#ifndef STATS_OMP_COST_rinvgauss
+    #define STATS_OMP_COST_rinvgauss ullint_t(27)
+#endif
+
+#ifndef STATS_OMP_COST_rlaplace_from_unit
+    #define STATS_OMP_COST_rlaplace_from_unit ullint_t(15)
+#endif
+
+#ifndef STATS_OMP_COST_rlnorm
+    #define STATS_OMP_COST_rlnorm ullint_t(23)
+#endif
+
+#ifndef STATS_OMP_COST_rlogis_from_unit
+    #define STATS_OMP_COST_rlogis_from_unit ullint_t(17)
+#endif
+
+#ifndef STATS_OMP_COST_rnorm_from_unit
+    #define STATS_OMP_COST_rnorm_from_unit ullint_t(46)
+#endif
+
+#ifndef STATS_OMP_COST_rnorm_vec_compute
+    #define STATS_OMP_COST_rnorm_vec_compute ullint_t(21)
+#endif
+
+#ifndef STATS_OMP_COST_rpois_draw
+    #define STATS_OMP_COST_rpois_draw ullint_t(30)
+#endif
+
+#ifndef STATS_OMP_COST_rradem
+    #define STATS_OMP_COST_rradem ullint_t(18)
+#endif
+
+#ifndef STATS_OMP_COST_rt_draw
+    #define STATS_OMP_COST_rt_draw ullint_t(54)
+#endif
+
+#ifndef STATS_OMP_COST_runif_from_unit
+    #define STATS_OMP_COST_runif_from_unit ullint_t(10)
+#endif
+
+#ifndef STATS_OMP_COST_rweibull_from_unit
+    #define STATS_OMP_COST_rweibull_from_unit ullint_t(35)
+#endif
+
+// seeding one engine stream, paid once per thread by sequential engines
+
+#ifndef STATS_OMP_COST_stream_engine
+    #define STATS_OMP_COST_stream_engine ullint_t(8886)
+#endif
+
+// a user-supplied quantile function passed to qmc_fill without a cost estimate
+
+#ifndef STATS_OMP_COST_qmc_quantile
+    #define STATS_OMP_COST_qmc_quantile ullint_t(100)
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Work partitioning for parallel loops, run through OpenMP or the built-in thread pool
+ */
+
+#ifndef _statslib_omp_sched_HPP
+#define _statslib_omp_sched_HPP
+
+namespace internal
+{
+
+// first item of block j when num_elem items are split into n_blocks contiguous blocks whose sizes differ by
+// at most one
+
+statslib_constexpr
+ullint_t
+omp_block_begin(const ullint_t j, const ullint_t n_blocks, const ullint_t num_elem)
+noexcept
+{
+    return (num_elem / n_blocks) * j + (j < num_elem % n_blocks ? j : num_elem % n_blocks);
+}
+
+// calls task_fn(j) for j = 0, ..., n_tasks-1 on up to n_threads threads, handing out the tasks dynamically;
+// without OpenMP or the thread pool, the tasks run in order on the calling thread
+
+template<typename fT>
+statslib_inline
+void
+omp_run(const ullint_t n_tasks, const ullint_t n_threads, fT task_fn)
+{
+#if defined(STATS_USE_OPENMP)
+    #pragma omp parallel for num_threads(n_threads) schedule(dynamic) if(n_threads > ullint_t(1))
+    for (ullint_t j=ullint_t(0); j < n_tasks; ++j)
+    {
+        task_fn(j);
+    }
+#else
+    #ifdef STATS_USE_THREAD_POOL
+    if (n_threads > ullint_t(1)) {
+        thread_pool::global().run(n_tasks,n_threads,task_fn);
+        return;
+    }
+    #else
+    STATS_UNUSED_PAR(n_threads);
+    #endif
+
+    for (ullint_t j=ullint_t(0); j < n_tasks; ++j)
+    {
+        task_fn(j);
+    }
+#endif
+}
+
+}
+
+#ifdef STATS_USE_PARALLEL
+
+namespace internal
+{
+
+// number of threads for a loop over num_elem items of unknown cost, so that each thread takes at least
+// min_per_thread items
+
+statslib_inline
+ullint_t
+omp_n_threads(const ullint_t num_elem, const ullint_t min_per_thread)
+{
+#ifdef STATS_USE_OPENMP
+    ullint_t n_threads = static_cast<ullint_t>(omp_get_max_threads());
+#else
+    ullint_t n_threads = thread_pool::global_size();
+#endif
+
+#ifdef STATS_OMP_MAX_THREADS
+    n_threads = std::min(n_threads, static_cast<ullint_t>(STATS_OMP_MAX_THREADS));
+#endif
+
+    return std::max(ullint_t(1), std::min(n_threads, num_elem / std::max(min_per_thread, ullint_t(1))));
+}
+
+// number of threads for a loop over num_elem elements that cost about cost_ns nanoseconds each (see omp_cost.hpp),
+// where each thread also pays setup_ns once, e.g., to seed its engine: a thread is only added for at least
+// STATS_OMP_MIN_NS_PER_THREAD of work, so small calls to cheap kernels run serially
+
+statslib_inline
+ullint_t
+omp_n_threads_cost(const ullint_t num_elem, const ullint_t cost_ns, const ullint_t setup_ns)
+{
+    const double work_ns = static_cast<double>(num_elem) * static_cast<double>(cost_ns);
+    const double work_per_thread = work_ns / static_cast<double>(STATS_OMP_MIN_NS_PER_THREAD + setup_ns);
+
+    const ullint_t n_threads = omp_n_threads(num_elem,ullint_t(1));
+
+    return work_per_thread < static_cast<double>(n_threads) ? std::max(ullint_t(1), static_cast<ullint_t>(work_per_thread)) : n_threads;
+}
+
+// chunk size for a dynamically scheduled loop: at least STATS_OMP_MIN_NS_PER_CHUNK of work, to amortize the
+// scheduling overhead; otherwise no more output than STATS_OMP_CHUNK_BYTES, and at least four chunks per thread,
+// so that the load stays balanced when the cost per element varies
+
+template<typename T>
+statslib_inline
+ullint_t
+omp_chunk_size(const ullint_t num_elem, const ullint_t n_threads, const ullint_t cost_ns)
+noexcept
+{
+    const ullint_t cache_chunk = STATS_OMP_CHUNK_BYTES / sizeof(T);
+    const ullint_t balance_chunk = num_elem / (ullint_t(4) * n_threads);
+    const ullint_t overhead_chunk = STATS_OMP_MIN_NS_PER_CHUNK / std::max(cost_ns, ullint_t(1));
+
+    return std::max(ullint_t(1), std::max(overhead_chunk, std::min(cache_chunk, balance_chunk)));
+}
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,174 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * raw random bits and their conversion to uniform variates
+ */
+
+#ifndef _statslib_rand_bits_HPP
+#define _statslib_rand_bits_HPP
+
+namespace internal
+{
+
+// 64 random bits from any uniform random bit generator
+
+template<typename eT>
+statslib_inline
+ullint_t
+rand_u64(eT& engine)
+{
+    constexpr ullint_t eng_range = static_cast<ullint_t>(eT::max()) - static_cast<ullint_t>(eT::min());
+
+    if (eng_range == ~ullint_t(0)) {
+        return static_cast<ullint_t>(engine()) - static_cast<ullint_t>(eT::min());
+    } else if (eng_range == ullint_t(0xFFFFFFFFULL)) {
+        const ullint_t hi_bits = static_cast<ullint_t>(engine()) - static_cast<ullint_t>(eT::min());
+        const ullint_t lo_bits = static_cast<ullint_t>(engine()) - static_cast<ullint_t>(eT::min());
+
+        return (hi_bits << 32) | lo_bits;
+    } else {
+        std::uniform_int_distribution<ullint_t> u64_dist(ullint_t(0), ~ullint_t(0));
+        return u64_dist(engine);
+    }
+}
+
+// high and low 64 bits of the full product a*b
+
+statslib_inline
+void
+mul_u64(const ullint_t a, const ullint_t b, ullint_t& hi, ullint_t& lo)
+noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    const uint128_t prod = static_cast<uint128_t>(a) * b;
+
+    hi = static_cast<ullint_t>(prod >> 64);
+    lo = static_cast<ullint_t>(prod);
+#else
+    const ullint_t a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+    const ullint_t b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+
+    const ullint_t ll = a_lo * b_lo;
+    const ullint_t lh = a_lo * b_hi;
+    const ullint_t hl = a_hi * b_lo;
+    const ullint_t hh = a_hi * b_hi;
+
+    const ullint_t mid = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+
+    hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    lo = a * b;
+#endif
+}
+
+// number of random bits used per draw of type T, and the corresponding unit of least precision
+
+template<typename T>
+statslib_constexpr
+int
+unit_bits()
+noexcept
+{
+    return( STLIM<T>::digits < 64 ? STLIM<T>::digits : 64 );
+}
+
+template<typename T>
+statslib_constexpr
+T
+unit_ulp(const int n_bits)
+noexcept
+{
+    return T(1) / ( T(ullint_t(1) << (n_bits - 1)) * T(2) );
+}
+
+// uniform on [0,1), using the top unit_bits<T>() bits
+
+template<typename T = double>
+statslib_constexpr
+T
+u64_to_unit_co(const ullint_t bits)
+noexcept
+{
+    return T(bits >> (64 - unit_bits<T>())) * unit_ulp<T>(unit_bits<T>());
+}
+
+// uniform on (0,1), offset by half a step from both endpoints
+
+template<typename T = double>
+statslib_constexpr
+T
+u64_to_unit_oo(const ullint_t bits)
+noexcept
+{
+    return ( T(bits >> (65 - unit_bits<T>())) + T(0.5) ) * unit_ulp<T>(unit_bits<T>() - 1);
+}
+
+// uniform on (0,1) from the low 32 bits, for types with at most 32 bits of precision
+
+template<typename T>
+statslib_constexpr
+int
+unit_bits_32()
+noexcept
+{
+    return( unit_bits<T>() < 32 ? unit_bits<T>() : 32 );
+}
+
+template<typename T = float>
+statslib_constexpr
+T
+u32_to_unit_oo(const ullint_t bits)
+noexcept
+{
+    return ( T((bits & 0xFFFFFFFFULL) >> (33 - unit_bits_32<T>())) + T(0.5) ) * unit_ulp<T>(unit_bits_32<T>() - 1);
+}
+
+// bulk uniform (0,1) draws; types with at most 32 bits of precision take two draws per 64-bit word
+
+template<typename T, typename eT>
+statslib_inline
+void
+fill_unit_oo(eT& engine, T* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    if (unit_bits<T>() <= 32) {
+        ullint_t i = 0;
+
+        for (; i + 1 < num_elem; i += 2) {
+            const ullint_t bits = rand_u64(engine);
+
+            vals_out[i]   = u32_to_unit_oo<T>(bits >> 32);
+            vals_out[i+1] = u32_to_unit_oo<T>(bits);
+        }
+
+        if (i < num_elem) {
+            vals_out[i] = u32_to_unit_oo<T>(rand_u64(engine) >> 32);
+        }
+    } else {
+        for (ullint_t i = 0; i < num_elem; ++i) {
+            vals_out[i] = u64_to_unit_oo<T>(rand_u64(engine));
+        }
+    }
+}
+
+}
+
+#endif
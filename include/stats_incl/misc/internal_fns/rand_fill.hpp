@@ -0,0 +1,374 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * fill an array with random draws; draw_fn(engine) returns one draw
+ */
+
+#ifndef _statslib_rand_fill_HPP
+#define _statslib_rand_fill_HPP
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// values drawn per block by the bulk samplers; counter-based engines also split fills into chunks of
+// four blocks, each drawn from its own substream
+
+#ifndef STATS_RAND_UNIT_BLOCK_SIZE
+    #define STATS_RAND_UNIT_BLOCK_SIZE ullint_t(256)
+#endif
+
+namespace internal
+{
+
+// sequential engines: with OpenMP or the thread pool, the output is split into one contiguous block per
+// thread, and each block draws from its own independently seeded stream
+
+template<typename eT, typename rT, typename fT>
+statslib_inline
+void
+rand_fill_vec(rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, eT& engine_0, fT draw_fn, const ullint_t cost_ns)
+{
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_threads = omp_n_threads_cost(num_elem,cost_ns,STATS_OMP_COST_stream_engine);
+
+    if (n_threads > ullint_t(1))
+    {
+        // one draw from engine_0 keys the whole set of block streams
+
+        const ullint_t stream_key = rand_u64(engine_0);
+
+        omp_run(n_threads, n_threads, [&](const ullint_t j)
+        {
+            eT engine_j = stream_engine<eT>(stream_key,j);
+
+            const ullint_t block_end = omp_block_begin(j+1,n_threads,num_elem);
+
+            for (ullint_t i=omp_block_begin(j,n_threads,num_elem); i < block_end; ++i)
+            {
+                vals_out[i] = draw_fn(engine_j);
+            }
+        });
+
+        return;
+    }
+#else
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    for (ullint_t i=ullint_t(0); i < num_elem; ++i)
+    {
+        vals_out[i] = draw_fn(engine_0);
+    }
+}
+
+// counter-based engines: chunk c of the output draws in order from substream c of engine_0's current
+// position, so the output does not depend on the number of threads or on how the work is split
+
+template<typename rT, typename fT>
+statslib_inline
+void
+rand_fill_vec(rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, philox_engine& engine_0, fT draw_fn, const ullint_t cost_ns)
+{
+    const philox_engine engine_base = engine_0;
+
+    // move engine_0 to a fresh block so that the next fill uses different substreams
+    engine_0.discard(4);
+
+    const ullint_t chunk_size = 4 * STATS_RAND_UNIT_BLOCK_SIZE;
+    const ullint_t n_chunks = (num_elem + chunk_size - 1) / chunk_size;
+
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_threads = std::min(omp_n_threads_cost(num_elem,cost_ns,ullint_t(0)),n_chunks);
+#else
+    const ullint_t n_threads = ullint_t(1);
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    omp_run(n_chunks, n_threads, [&](const ullint_t c)
+    {
+        const ullint_t chunk_end = std::min(num_elem, (c+1) * chunk_size);
+
+        philox_engine engine_c = engine_base.substream(c);
+
+        for (ullint_t i=c*chunk_size; i < chunk_end; ++i)
+        {
+            vals_out[i] = draw_fn(engine_c);
+        }
+    });
+}
+
+//
+// multivariate draws: block_fn(i_begin, i_end, engine) produces all output for items i_begin, ..., i_end - 1,
+// e.g., rows of a matrix, at an estimated cost of cost_ns nanoseconds per item. Each block runs on a single
+// thread, so scratch space can be allocated once per block rather than once per item.
+
+template<typename eT, typename fT>
+statslib_inline
+void
+rand_run_blocks(const ullint_t num_items, eT& engine_0, fT block_fn, const ullint_t cost_ns)
+{
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_threads = omp_n_threads_cost(num_items,cost_ns,STATS_OMP_COST_stream_engine);
+
+    if (n_threads > ullint_t(1))
+    {
+        const ullint_t stream_key = rand_u64(engine_0);
+
+        omp_run(n_threads, n_threads, [&](const ullint_t j)
+        {
+            eT engine_j = stream_engine<eT>(stream_key,j);
+
+            block_fn(omp_block_begin(j,n_threads,num_items),omp_block_begin(j+1,n_threads,num_items),engine_j);
+        });
+
+        return;
+    }
+#else
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    block_fn(ullint_t(0),num_items,engine_0);
+}
+
+// counter-based engines: chunk c of the items draws in order from substream c of engine_0's current position
+
+template<typename fT>
+statslib_inline
+void
+rand_run_blocks(const ullint_t num_items, philox_engine& engine_0, fT block_fn, const ullint_t cost_ns)
+{
+    const philox_engine engine_base = engine_0;
+
+    engine_0.discard(4);
+
+    // items are costly (a row, a matrix), so chunks are small
+    const ullint_t chunk_size = 16;
+    const ullint_t n_chunks = (num_items + chunk_size - 1) / chunk_size;
+
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_threads = std::min(omp_n_threads_cost(num_items,cost_ns,ullint_t(0)),n_chunks);
+#else
+    const ullint_t n_threads = ullint_t(1);
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    omp_run(n_chunks, n_threads, [&](const ullint_t c)
+    {
+        philox_engine engine_c = engine_base.substream(c);
+
+        block_fn(c*chunk_size,std::min(num_items, (c+1) * chunk_size),engine_c);
+    });
+}
+
+// one item at a time: work_fn(i, engine) produces all output for item i
+
+template<typename eT, typename fT>
+statslib_inline
+void
+rand_run_vec(const ullint_t num_items, eT& engine_0, fT work_fn, const ullint_t cost_ns)
+{
+    rand_run_blocks(num_items,engine_0,
+        [&](const ullint_t i_begin, const ullint_t i_end, eT& engine_b)
+        {
+            for (ullint_t i=i_begin; i < i_end; ++i)
+            {
+                work_fn(i,engine_b);
+            }
+        },
+        cost_ns);
+}
+
+//
+// inversion samplers: vals_out[i] = transform_fn(u_i), with u_i ~ U(0,1) of type T generated in bulk.
+// A distribution registers by providing a branch-free rX_from_unit(u, pars...) transform, called through
+// RAND_UNIT_FN_VEC once its parameters have been checked for the whole batch.
+
+template<typename T, typename eT, typename rT, typename fT>
+statslib_inline
+void
+rand_fill_unit_block(rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, eT& engine, fT& transform_fn)
+{
+    T unit_vals[STATS_RAND_UNIT_BLOCK_SIZE];
+
+    for (ullint_t i0 = ullint_t(0); i0 < num_elem; i0 += STATS_RAND_UNIT_BLOCK_SIZE)
+    {
+        const ullint_t n_vals = std::min(STATS_RAND_UNIT_BLOCK_SIZE, num_elem - i0);
+
+        fill_unit_oo(engine,unit_vals,n_vals);
+
+        // transform in place first, so that the loop runs over a single type and can be vectorized
+
+        for (ullint_t j=ullint_t(0); j < n_vals; ++j)
+        {
+            unit_vals[j] = transform_fn(unit_vals[j]);
+        }
+
+        std::copy(unit_vals, unit_vals + n_vals, vals_out + i0);
+    }
+}
+
+template<typename T, typename eT, typename rT, typename fT>
+statslib_inline
+void
+rand_fill_unit_vec(rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, eT& engine_0, fT transform_fn, const ullint_t cost_ns)
+{
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_threads = omp_n_threads_cost(num_elem,cost_ns,STATS_OMP_COST_stream_engine);
+
+    if (n_threads > ullint_t(1))
+    {
+        const ullint_t stream_key = rand_u64(engine_0);
+
+        omp_run(n_threads, n_threads, [&](const ullint_t j)
+        {
+            eT engine_j = stream_engine<eT>(stream_key,j);
+
+            const ullint_t block_begin = omp_block_begin(j,n_threads,num_elem);
+            const ullint_t block_size = omp_block_begin(j+1,n_threads,num_elem) - block_begin;
+
+            rand_fill_unit_block<T>(vals_out + block_begin, block_size, engine_j, transform_fn);
+        });
+
+        return;
+    }
+#else
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    rand_fill_unit_block<T>(vals_out, num_elem, engine_0, transform_fn);
+}
+
+// counter-based engines: the uniforms are one sequence, read from substream ~0 of engine_0's
+// current position; each chunk jumps directly to its offset in that sequence
+
+template<typename T, typename rT, typename fT>
+statslib_inline
+void
+rand_fill_unit_vec(rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, philox_engine& engine_0, fT transform_fn, const ullint_t cost_ns)
+{
+    const philox_engine engine_base = engine_0.substream(~ullint_t(0));
+
+    engine_0.discard(4);
+
+    // a multiple of the block size, so that chunks do not split a 64-bit word between two draws
+    const ullint_t chunk_size = 4 * STATS_RAND_UNIT_BLOCK_SIZE;
+    const ullint_t n_chunks = (num_elem + chunk_size - 1) / chunk_size;
+    const ullint_t draws_per_word = (unit_bits<T>() <= 32) ? 2 : 1;
+
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_threads = std::min(omp_n_threads_cost(num_elem,cost_ns,ullint_t(0)),n_chunks);
+#else
+    const ullint_t n_threads = ullint_t(1);
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    omp_run(n_chunks, n_threads, [&](const ullint_t c)
+    {
+        const ullint_t chunk_start = c * chunk_size;
+
+        philox_engine engine_c = engine_base;
+        engine_c.discard(chunk_start / draws_per_word);
+
+        rand_fill_unit_block<T>(vals_out + chunk_start, std::min(chunk_size, num_elem - chunk_start), engine_c, transform_fn);
+    });
+}
+
+//
+// block samplers: block_fn(vals_out, n, engine) fills n <= STATS_RAND_UNIT_BLOCK_SIZE values at a time, drawing
+// the variates it needs into local buffers first, so that the transform runs as a vectorizable loop
+
+template<typename eT, typename rT, typename fT>
+statslib_inline
+void
+rand_fill_block_run(rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, eT& engine, fT& block_fn)
+{
+    for (ullint_t i0 = ullint_t(0); i0 < num_elem; i0 += STATS_RAND_UNIT_BLOCK_SIZE)
+    {
+        block_fn(vals_out + i0, std::min(STATS_RAND_UNIT_BLOCK_SIZE, num_elem - i0), engine);
+    }
+}
+
+template<typename eT, typename rT, typename fT>
+statslib_inline
+void
+rand_fill_block_vec(rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, eT& engine_0, fT block_fn, const ullint_t cost_ns)
+{
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_threads = omp_n_threads_cost(num_elem,cost_ns,STATS_OMP_COST_stream_engine);
+
+    if (n_threads > ullint_t(1))
+    {
+        const ullint_t stream_key = rand_u64(engine_0);
+
+        omp_run(n_threads, n_threads, [&](const ullint_t j)
+        {
+            eT engine_j = stream_engine<eT>(stream_key,j);
+
+            const ullint_t block_begin = omp_block_begin(j,n_threads,num_elem);
+            const ullint_t block_size = omp_block_begin(j+1,n_threads,num_elem) - block_begin;
+
+            rand_fill_block_run(vals_out + block_begin, block_size, engine_j, block_fn);
+        });
+
+        return;
+    }
+#else
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    rand_fill_block_run(vals_out, num_elem, engine_0, block_fn);
+}
+
+// counter-based engines: chunk c draws from substream c of engine_0's current position
+
+template<typename rT, typename fT>
+statslib_inline
+void
+rand_fill_block_vec(rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, philox_engine& engine_0, fT block_fn, const ullint_t cost_ns)
+{
+    const philox_engine engine_base = engine_0;
+
+    engine_0.discard(4);
+
+    const ullint_t chunk_size = 4 * STATS_RAND_UNIT_BLOCK_SIZE;
+    const ullint_t n_chunks = (num_elem + chunk_size - 1) / chunk_size;
+
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_threads = std::min(omp_n_threads_cost(num_elem,cost_ns,ullint_t(0)),n_chunks);
+#else
+    const ullint_t n_threads = ullint_t(1);
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    omp_run(n_chunks, n_threads, [&](const ullint_t c)
+    {
+        const ullint_t chunk_start = c * chunk_size;
+
+        philox_engine engine_c = engine_base.substream(c);
+
+        rand_fill_block_run(vals_out + chunk_start, std::min(chunk_size, num_elem - chunk_start), engine_c, block_fn);
+    });
+}
+
+}
+
+#endif
+
+#endif
@@ -18,19 +18,134 @@
   ##
   ################################################################################*/
 
+/*
+ * seeding of independent parallel streams
+ */
+
 #ifndef _statslib_seed_values_HPP
 #define _statslib_seed_values_HPP
 
-template<typename T1, typename T2>
+namespace internal
+{
+
+// SplitMix64 (Steele, Lea, and Flood, 2014)
+
+statslib_constexpr
+ullint_t
+splitmix64_xorshift(const ullint_t z, const int n_shift)
+noexcept
+{
+    return z ^ (z >> n_shift);
+}
+
+statslib_constexpr
+ullint_t
+splitmix64_mix(const ullint_t z)
+noexcept
+{
+    return splitmix64_xorshift( splitmix64_xorshift( splitmix64_xorshift(z,30) * 0xBF58476D1CE4E5B9ULL, 27) * 0x94D049BB133111EBULL, 31);
+}
+
 statslib_inline
-common_return_t<T1,T2>
-runif(const T1 a_par, const T2 b_par, rand_engine_t& engine);
+ullint_t
+splitmix64_next(ullint_t& state)
+noexcept
+{
+    state += 0x9E3779B97F4A7C15ULL;
+    return splitmix64_mix(state);
+}
+
+// seed sequence for the stream_ind-th stream under stream_key; each 64-bit output of
+// SplitMix64 supplies two 32-bit seed words, enough to fill any engine's state via std::seed_seq
+
+template<typename eT>
+statslib_inline
+eT
+stream_engine(const ullint_t stream_key, const ullint_t stream_ind)
+{
+    ullint_t sm_state = splitmix64_mix(stream_key ^ splitmix64_mix(stream_ind + 0x9E3779B97F4A7C15ULL));
 
-inline
-size_t
-generate_seed_value(const int ind_inp, const int n_threads, rand_engine_t& rand_engine)
+    std::uint_least32_t seed_words[16];
+
+    for (int i = 0; i < 16; i += 2) {
+        const ullint_t sm_val = splitmix64_next(sm_state);
+
+        seed_words[i]   = static_cast<std::uint_least32_t>(sm_val & 0xFFFFFFFFULL);
+        seed_words[i+1] = static_cast<std::uint_least32_t>(sm_val >> 32);
+    }
+
+    std::seed_seq seed_seq(seed_words, seed_words + 16);
+
+    return eT(seed_seq);
+}
+
+// counter-based engines: distinct streams are distinct keys, so no seeding is required
+
+template<>
+statslib_inline
+philox_engine
+stream_engine<philox_engine>(const ullint_t stream_key, const ullint_t stream_ind)
+{
+    return philox_engine(stream_key,stream_ind);
+}
+
+}
+
+/**
+ * @brief Random engine for one of many independent parallel streams
+ *
+ * @param seed_val a seed value common to all streams.
+ * @param stream_ind the index of the stream.
+ *
+ * @return a random engine whose sequence depends only on \c seed_val and \c stream_ind.
+ *
+ * Example:
+ * \code{.cpp}
+ * // one engine per thread
+ * stats::rand_engine_t engine = stats::stream_engine(1776,thread_ind);
+ * \endcode
+ */
+
+template<typename eT = rand_engine_t>
+statslib_inline
+eT
+stream_engine(const ullint_t seed_val, const ullint_t stream_ind)
+{
+    return internal::stream_engine<eT>(seed_val,stream_ind);
+}
+
+/**
+ * @brief Per-thread random engine
+ *
+ * @return a reference to the calling thread's engine, seeded by \c std::random_device on first use.
+ *
+ * With \c STATS_USE_THREAD_LOCAL_ENGINE defined, r* calls that pass neither an engine nor a seed draw from this engine.
+ */
+
+statslib_inline
+rand_engine_t&
+thread_local_engine()
+{
+    static thread_local rand_engine_t engine(std::random_device{}());
+    return engine;
+}
+
+/**
+ * @brief Reseed the calling thread's engine
+ *
+ * @param seed_val a seed value.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::seed_thread_local_engine(1776);
+ * \endcode
+ */
+
+statslib_inline
+void
+seed_thread_local_engine(const ullint_t seed_val)
 {
-    return static_cast<size_t>( (runif(0.0, 1.0, rand_engine) + ind_inp + n_threads) * 1000 );
+    thread_local_engine() = rand_engine_t(seed_val);
 }
 
-#endif
\ No newline at end of file
+#endif
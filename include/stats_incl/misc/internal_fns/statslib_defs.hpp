@@ -32,90 +32,30 @@
 //
 // vector code
 
-#ifdef STATS_USE_OPENMP
+#ifdef STATS_USE_PARALLEL
 
-#define EVAL_DIST_FN_VEC(dist_name, vals_in, vals_out, num_elem,                        \
-                         ...)                                                           \
-{                                                                                       \
-    ullint_t n_threads = omp_get_max_threads();                                         \
-    n_threads = std::min(n_threads,STATS_OMP_N_BLOCKS);                                 \
-                                                                                        \
-    ullint_t n_per_block = num_elem / n_threads;                                        \
-    ullint_t n_remainder = num_elem % n_threads;                                        \
-                                                                                        \
-    if (n_per_block > STATS_OMP_MIN_N_PER_BLOCK)                                        \
-    {                                                                                   \
-        _Pragma("omp parallel for")                                                     \
-        for (ullint_t j=ullint_t(0); j < n_threads; ++j)                                \
-        {                                                                               \
-            ullint_t block_dim = j*n_per_block;                                         \
-            for (ullint_t i=ullint_t(0); i < n_per_block; ++i)                          \
-            {                                                                           \
-                vals_out[i+block_dim] = dist_name(vals_in[i+block_dim],__VA_ARGS__);    \
-            }                                                                           \
-        }                                                                               \
-                                                                                        \
-        if (n_remainder > ullint_t(0))                                                  \
-        {                                                                               \
-            ullint_t begin_ind = num_elem - n_remainder - ullint_t(1);                  \
-            for (ullint_t i=begin_ind; i < num_elem; ++i)                               \
-            {                                                                           \
-                vals_out[i] = dist_name(vals_in[i],__VA_ARGS__);                        \
-            }                                                                           \
-        }                                                                               \
-    } else {                                                                            \
-        for (ullint_t i=ullint_t(0); i < num_elem; ++i)                                 \
-        {                                                                               \
-            vals_out[i] = dist_name(vals_in[i],__VA_ARGS__);                            \
-        }                                                                               \
-    }                                                                                   \
-}                                                                                       \
+// the number of threads and the chunk size follow from the kernel's estimated cost per element (omp_cost.hpp);
+// chunks are dealt out on demand, so threads that reach cheap elements (e.g., quantiles that converge in few
+// iterations) take more chunks
 
-//
-
-#define RAND_DIST_FN_VEC(dist_name, vals_out, num_elem, engine_0,                       \
+#define EVAL_DIST_FN_VEC(dist_name, vals_in, vals_out, num_elem,                        \
                          ...)                                                           \
 {                                                                                       \
-    ullint_t n_threads = omp_get_max_threads();                                         \
-    n_threads = std::min(n_threads,STATS_OMP_N_BLOCKS);                                 \
+    typedef typename std::decay<decltype(vals_out[0])>::type eval_rT;                   \
                                                                                         \
-    ullint_t n_per_block = num_elem / n_threads;                                        \
-    ullint_t n_remainder = num_elem % n_threads;                                        \
+    const ullint_t eval_cost = STATS_OMP_COST_##dist_name;                              \
+    const ullint_t n_threads = omp_n_threads_cost(num_elem,eval_cost,ullint_t(0));      \
+    const ullint_t chunk_size = omp_chunk_size<eval_rT>(num_elem,n_threads,eval_cost);  \
+    const ullint_t n_chunks = (num_elem + chunk_size - ullint_t(1)) / chunk_size;       \
                                                                                         \
-    if (n_per_block > STATS_OMP_MIN_N_PER_BLOCK)                                        \
-    {                                                                                   \
-        std::vector<rand_engine_t> engines;                                             \
+    omp_run(n_chunks, n_threads,                                                        \
+            [&](const ullint_t c){                                                      \
+                const ullint_t chunk_end = std::min(num_elem, (c+1)*chunk_size);        \
                                                                                         \
-        for (ullint_t k=ullint_t(0); k < n_threads; ++k)                                \
-        {                                                                               \
-            size_t seed_val = generate_seed_value(k, n_threads, engine_0);              \
-            engines.push_back(rand_engine_t(seed_val));                                 \
-        }                                                                               \
-                                                                                        \
-        _Pragma("omp parallel for")                                                     \
-        for (ullint_t j=ullint_t(0); j < n_threads; ++j)                                \
-        {                                                                               \
-            ullint_t block_dim = j*n_per_block;                                         \
-            for (ullint_t i=ullint_t(0); i < n_per_block; ++i)                          \
-            {                                                                           \
-                vals_out[i+block_dim] = dist_name(__VA_ARGS__,engines[j]);              \
-            }                                                                           \
-        }                                                                               \
-                                                                                        \
-        if (n_remainder > ullint_t(0))                                                  \
-        {                                                                               \
-            ullint_t begin_ind = num_elem - n_remainder - ullint_t(1);                  \
-            for (ullint_t i=begin_ind; i < num_elem; ++i)                               \
-            {                                                                           \
-                vals_out[i] = dist_name(__VA_ARGS__,engines[0]);                        \
-            }                                                                           \
-        }                                                                               \
-    } else {                                                                            \
-        for (ullint_t i=ullint_t(0); i < num_elem; ++i)                                 \
-        {                                                                               \
-            vals_out[i] = dist_name(__VA_ARGS__,engine_0);                              \
-        }                                                                               \
-    }                                                                                   \
+                for (ullint_t i=c*chunk_size; i < chunk_end; ++i)                       \
+                {                                                                       \
+                    vals_out[i] = dist_name(vals_in[i],__VA_ARGS__);                    \
+                } });                                                                   \
 }                                                                                       \
 
 //
@@ -131,16 +71,25 @@
     }                                                                                   \
 }                                                                                       \
 
+#endif
+
 #define RAND_DIST_FN_VEC(dist_name, vals_out, num_elem, engine_0,                       \
                          ...)                                                           \
 {                                                                                       \
-    for (ullint_t j=ullint_t(0); j < num_elem; ++j)                                     \
-    {                                                                                   \
-        vals_out[j] = dist_name(__VA_ARGS__,engine_0);                                  \
-    }                                                                                   \
+    rand_fill_vec(vals_out, num_elem, engine_0,                                         \
+                  [&](rand_engine_t& engine_i){                                         \
+                      return dist_name(__VA_ARGS__,engine_i); },                        \
+                  STATS_OMP_COST_##dist_name);                                          \
 }                                                                                       \
 
-#endif
+#define RAND_UNIT_FN_VEC(T, transform_name, vals_out, num_elem, engine_0,              \
+                         ...)                                                           \
+{                                                                                       \
+    rand_fill_unit_vec<T>(vals_out, num_elem, engine_0,                                 \
+                          [&](const T unit_val){                                        \
+                              return transform_name(unit_val,__VA_ARGS__); },           \
+                          STATS_OMP_COST_##transform_name);                             \
+}                                                                                       \
 
 
 //
@@ -220,6 +169,22 @@ define GEN_MAT_RAND_FN(dist_name_vec, ...)
     return mat_out;                                                                     \
 }
 
+#define GEN_MAT_RAND_MODE_FN(T, par_check, transform_name, ...)                         \
+{                                                                                       \
+    mT mat_out;                                                                         \
+    mat_ops::resize(mat_out,n,k);                                                       \
+                                                                                        \
+    const bool pars_valid = par_check;                                                  \
+                                                                                        \
+    internal::rand_mode_fill<T>(mat_out,n,k,mode,engine,                                \
+        [&](const T unit_val){                                                          \
+            return pars_valid ? internal::transform_name(unit_val,__VA_ARGS__) :        \
+                                STLIM<T>::quiet_NaN(); },                               \
+        STATS_OMP_COST_##transform_name);                                               \
+                                                                                        \
+    return mat_out;                                                                     \
+}
+
 #define STDVEC_RAND_DIST_FN(dist_name, ...)                                             \
 {                                                                                       \
     STATS_VEC_NAME(dist_name)(__VA_ARGS__,X.data(),X.size());                           \
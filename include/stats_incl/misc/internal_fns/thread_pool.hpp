@@ -0,0 +1,326 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * A work-stealing pool of std::thread workers, used for parallel loops in place of OpenMP
+ */
+
+#ifndef _statslib_thread_pool_HPP
+#define _statslib_thread_pool_HPP
+
+#ifdef STATS_USE_THREAD_POOL
+
+namespace internal
+{
+
+// A loop of n_tasks tasks runs on the calling thread and up to n_threads - 1 workers. Each participant starts
+// with a contiguous range of tasks, takes tasks from the front of its own range and, once that is empty,
+// steals from the back of the other ranges. A range is one 64-bit word holding [begin, end) in two 32-bit
+// halves, so owner and thieves each claim a task with a single compare-and-swap.
+
+class thread_pool
+{
+    public:
+        explicit thread_pool(const ullint_t n_threads_max);
+        ~thread_pool();
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        // the pool used by the vector functions, started on first use with global_size() threads
+        static thread_pool& global();
+        static ullint_t global_size() noexcept;
+
+        // number of threads, the calling thread included
+        ullint_t size() const noexcept { return ranges_.size(); }
+
+        // calls task_fn(j) for j = 0, ..., n_tasks-1 and returns once all tasks are done; the loop runs
+        // serially when called from inside a task or while another thread's loop holds the pool
+        template<typename fT>
+        void run(const ullint_t n_tasks, const ullint_t n_threads, fT& task_fn);
+
+    private:
+        struct task_range
+        {
+            std::atomic<ullint_t> bounds{0};
+            char pad_[64];                  // keep the ranges on separate cache lines
+        };
+
+        static bool& in_task() noexcept;
+
+        static bool pop_front(task_range& range, ullint_t& task) noexcept;
+        static bool pop_back(task_range& range, ullint_t& task) noexcept;
+
+        void invoke(const ullint_t task) noexcept;
+        void work(const ullint_t slot, const ullint_t n_slots);
+        void worker_loop(const ullint_t slot);
+
+        std::vector<task_range> ranges_;
+        std::vector<std::thread> workers_;
+
+        // the current loop, set by run() before it is published under wake_mutex_
+
+        void (*job_invoke_)(void*, ullint_t) = nullptr;
+        void* job_fn_ = nullptr;
+        std::exception_ptr job_error_;
+
+        ullint_t job_slots_ = 0;
+        ullint_t job_gen_ = 0;
+        bool stop_ = false;
+
+        std::atomic<ullint_t> n_active_{0};
+
+        std::mutex run_mutex_;
+        std::mutex wake_mutex_;
+        std::condition_variable wake_cv_;
+        std::condition_variable done_cv_;
+};
+
+//
+
+statslib_inline
+thread_pool::thread_pool(const ullint_t n_threads_max)
+    : ranges_(n_threads_max > ullint_t(1) ? n_threads_max : ullint_t(1))
+{
+    for (ullint_t slot = 1U; slot < ranges_.size(); ++slot) {
+        workers_.emplace_back(&thread_pool::worker_loop, this, slot);
+    }
+}
+
+statslib_inline
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        stop_ = true;
+    }
+
+    wake_cv_.notify_all();
+
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+statslib_inline
+thread_pool&
+thread_pool::global()
+{
+    static thread_pool pool(global_size());
+    return pool;
+}
+
+statslib_inline
+ullint_t
+thread_pool::global_size()
+noexcept
+{
+    const ullint_t pool_size = static_cast<ullint_t>(STATS_THREAD_POOL_SIZE);
+
+    return pool_size > ullint_t(1) ? pool_size : ullint_t(1);
+}
+
+statslib_inline
+bool&
+thread_pool::in_task()
+noexcept
+{
+    static thread_local bool in_task_flag = false;
+    return in_task_flag;
+}
+
+statslib_inline
+bool
+thread_pool::pop_front(task_range& range, ullint_t& task)
+noexcept
+{
+    ullint_t bounds = range.bounds.load();
+
+    while ((bounds >> 32) < (bounds & 0xFFFFFFFFULL))
+    {
+        if (range.bounds.compare_exchange_weak(bounds, bounds + (ullint_t(1) << 32))) {
+            task = bounds >> 32;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+statslib_inline
+bool
+thread_pool::pop_back(task_range& range, ullint_t& task)
+noexcept
+{
+    ullint_t bounds = range.bounds.load();
+
+    while ((bounds >> 32) < (bounds & 0xFFFFFFFFULL))
+    {
+        if (range.bounds.compare_exchange_weak(bounds, bounds - ullint_t(1))) {
+            task = (bounds & 0xFFFFFFFFULL) - 1U;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// an exception thrown by a task is kept and rethrown by run(), once every participant has left the loop
+
+statslib_inline
+void
+thread_pool::invoke(const ullint_t task)
+noexcept
+{
+    try {
+        job_invoke_(job_fn_,task);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+
+        if (!job_error_) {
+            job_error_ = std::current_exception();
+        }
+    }
+}
+
+statslib_inline
+void
+thread_pool::work(const ullint_t slot, const ullint_t n_slots)
+{
+    ullint_t task;
+
+    while (pop_front(ranges_[slot],task)) {
+        invoke(task);
+    }
+
+    for (ullint_t k = 1U; k < n_slots; ++k)
+    {
+        task_range& victim = ranges_[(slot + k) % n_slots];
+
+        while (pop_back(victim,task)) {
+            invoke(task);
+        }
+    }
+}
+
+statslib_inline
+void
+thread_pool::worker_loop(const ullint_t slot)
+{
+    in_task() = true;
+
+    ullint_t seen_gen = 0U;
+
+    while (true)
+    {
+        ullint_t n_slots;
+
+        {
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_cv_.wait(lock, [&] { return stop_ || job_gen_ != seen_gen; });
+
+            if (stop_) {
+                return;
+            }
+
+            seen_gen = job_gen_;
+            n_slots = job_slots_;
+        }
+
+        if (slot >= n_slots) {
+            continue;
+        }
+
+        work(slot,n_slots);
+
+        // run() waits for every participant, so the loop's state stays valid until the last one is done
+
+        if (n_active_.fetch_sub(1U) == 1U) {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            done_cv_.notify_one();
+        }
+    }
+}
+
+template<typename fT>
+statslib_inline
+void
+thread_pool::run(const ullint_t n_tasks, const ullint_t n_threads, fT& task_fn)
+{
+    const ullint_t n_slots = std::min(std::min(n_threads, size()), n_tasks);
+
+    if (n_slots <= ullint_t(1) || n_tasks > ullint_t(0xFFFFFFFFULL) || in_task() || !run_mutex_.try_lock())
+    {
+        for (ullint_t j = 0U; j < n_tasks; ++j) {
+            task_fn(j);
+        }
+
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(run_mutex_, std::adopt_lock);
+
+    // contiguous starting ranges whose sizes differ by at most one
+
+    for (ullint_t s = 0U; s < n_slots; ++s)
+    {
+        const ullint_t range_begin = (n_tasks / n_slots) * s + std::min(s, n_tasks % n_slots);
+        const ullint_t range_end = range_begin + n_tasks / n_slots + (s < n_tasks % n_slots ? 1U : 0U);
+
+        ranges_[s].bounds.store((range_begin << 32) | range_end);
+    }
+
+    job_invoke_ = [](void* fn, const ullint_t task) { (*static_cast<fT*>(fn))(task); };
+    job_fn_ = static_cast<void*>(&task_fn);
+    job_error_ = nullptr;
+
+    n_active_.store(n_slots - 1U);
+
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        job_slots_ = n_slots;
+        ++job_gen_;
+    }
+
+    wake_cv_.notify_all();
+
+    in_task() = true;
+    work(0U,n_slots);
+    in_task() = false;
+
+    std::exception_ptr error;
+
+    {
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        done_cv_.wait(lock, [this] { return n_active_.load() == 0U; });
+
+        error = job_error_;
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,278 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Philox4x64-10 counter-based random number engine
+ *
+ * Salmon, Moraes, Dror, and Shaw (2011), "Parallel Random Numbers: As Easy as 1, 2, 3"
+ *
+ * Each block of four 64-bit outputs is a bijective function of a 256-bit counter
+ * under a 128-bit key. The key holds (seed, stream); the counter holds
+ *
+ *   [0] block index within the sequence
+ *   [1] substream index
+ *   [2] position of the parent sequence when the substream was created, combined with a
+ *       hash of the parent's own substream index, origin, and depth (see substream)
+ *   [3] substream depth (0 for a root sequence)
+ *
+ * so any output can be computed directly from (seed, stream, substream, position).
+ */
+
+#ifndef _statslib_philox_engine_HPP
+#define _statslib_philox_engine_HPP
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+namespace stats
+{
+
+class philox_engine
+{
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr result_type default_seed = 0;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return ~result_type(0); }
+
+        //
+
+        explicit philox_engine(const result_type seed_val = default_seed, const result_type stream_val = 0)
+        {
+            seed(seed_val,stream_val);
+        }
+
+        template<typename SeedSeq, typename = typename std::enable_if<!std::is_convertible<SeedSeq,result_type>::value &&
+                                                                       !std::is_same<typename std::decay<SeedSeq>::type,philox_engine>::value>::type>
+        explicit philox_engine(SeedSeq& seed_seq)
+        {
+            seed(seed_seq);
+        }
+
+        void seed(const result_type seed_val = default_seed, const result_type stream_val = 0)
+        {
+            key_[0] = seed_val;
+            key_[1] = stream_val;
+
+            ctr_[0] = ctr_[1] = ctr_[2] = ctr_[3] = 0;
+
+            buf_ind_ = 4;
+        }
+
+        template<typename SeedSeq, typename = typename std::enable_if<!std::is_convertible<SeedSeq,result_type>::value &&
+                                                                       !std::is_same<typename std::decay<SeedSeq>::type,philox_engine>::value>::type>
+        void seed(SeedSeq& seed_seq)
+        {
+            std::uint_least32_t seed_words[4];
+            seed_seq.generate(seed_words, seed_words + 4);
+
+            seed( (result_type(seed_words[1]) << 32) | (seed_words[0] & 0xFFFFFFFFULL),
+                  (result_type(seed_words[3]) << 32) | (seed_words[2] & 0xFFFFFFFFULL) );
+        }
+
+        result_type operator()()
+        {
+            if (buf_ind_ == 4) {
+                next_block();
+            }
+
+            return buf_[buf_ind_++];
+        }
+
+        void discard(unsigned long long n_skip)
+        {
+            const unsigned long long n_buffered = 4 - buf_ind_;
+
+            if (n_skip <= n_buffered) {
+                buf_ind_ += static_cast<unsigned>(n_skip);
+                return;
+            }
+
+            n_skip -= n_buffered;
+
+            ctr_[0] += (n_skip - 1) / 4;
+
+            next_block();
+            buf_ind_ = static_cast<unsigned>( (n_skip - 1) % 4 + 1 );
+        }
+
+        // independent sequence for the ind-th element of a parallel fill; depends only on
+        // the key, this engine's current position, this engine's own substream identity, and ind
+
+        philox_engine substream(const result_type ind) const
+        {
+            philox_engine sub_engine(key_[0],key_[1]);
+
+            sub_engine.ctr_[1] = ind;
+            sub_engine.ctr_[2] = ctr_[0] ^ origin_hash();
+            sub_engine.ctr_[3] = ctr_[3] + 1;
+
+            return sub_engine;
+        }
+
+        result_type stream() const
+        {
+            return key_[1];
+        }
+
+        //
+
+        friend bool operator==(const philox_engine& lhs, const philox_engine& rhs)
+        {
+            return lhs.key_[0] == rhs.key_[0] && lhs.key_[1] == rhs.key_[1] && lhs.buf_ind_ == rhs.buf_ind_
+                && lhs.ctr_[0] == rhs.ctr_[0] && lhs.ctr_[1] == rhs.ctr_[1] && lhs.ctr_[2] == rhs.ctr_[2] && lhs.ctr_[3] == rhs.ctr_[3];
+        }
+
+        friend bool operator!=(const philox_engine& lhs, const philox_engine& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        template<typename CharT, typename Traits>
+        friend std::basic_ostream<CharT,Traits>& operator<<(std::basic_ostream<CharT,Traits>& os, const philox_engine& eng)
+        {
+            const CharT space = os.widen(' ');
+
+            os << eng.key_[0] << space << eng.key_[1];
+
+            for (int i = 0; i < 4; ++i) {
+                os << space << eng.ctr_[i];
+            }
+
+            return os << space << eng.buf_ind_;
+        }
+
+        template<typename CharT, typename Traits>
+        friend std::basic_istream<CharT,Traits>& operator>>(std::basic_istream<CharT,Traits>& is, philox_engine& eng)
+        {
+            philox_engine tmp;
+
+            is >> tmp.key_[0] >> tmp.key_[1] >> tmp.ctr_[0] >> tmp.ctr_[1] >> tmp.ctr_[2] >> tmp.ctr_[3] >> tmp.buf_ind_;
+
+            if (is && tmp.buf_ind_ <= 4) {
+                if (tmp.buf_ind_ < 4) {
+                    // regenerate the partially consumed block
+                    const unsigned buf_ind = tmp.buf_ind_;
+
+                    tmp.ctr_[0] -= 1;
+                    tmp.next_block();
+
+                    tmp.buf_ind_ = buf_ind;
+                }
+
+                eng = tmp;
+            }
+
+            return is;
+        }
+
+    private:
+        result_type key_[2];
+        result_type ctr_[4];
+        result_type buf_[4];
+        unsigned buf_ind_;
+
+        //
+
+        static result_type splitmix(result_type x)
+        {
+            x += 0x9E3779B97F4A7C15ULL;
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+
+            return x ^ (x >> 31);
+        }
+
+        // zero for a root sequence; otherwise a hash of (substream, origin, depth), so that substreams of
+        // different parents at the same position differ, while those of one parent differ in position
+
+        result_type origin_hash() const
+        {
+            if (ctr_[3] == 0) {
+                return 0;
+            }
+
+            return splitmix(ctr_[1] ^ splitmix(ctr_[2] ^ splitmix(ctr_[3])));
+        }
+
+        static void mulhilo(const result_type a, const result_type b, result_type& hi, result_type& lo)
+        {
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef unsigned __int128 uint128_t;
+
+            const uint128_t prod = static_cast<uint128_t>(a) * b;
+
+            hi = static_cast<result_type>(prod >> 64);
+            lo = static_cast<result_type>(prod);
+#else
+            const result_type a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+            const result_type b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+
+            const result_type ll = a_lo * b_lo;
+            const result_type lh = a_lo * b_hi;
+            const result_type hl = a_hi * b_lo;
+            const result_type hh = a_hi * b_hi;
+
+            const result_type mid = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+
+            hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+            lo = a * b;
+#endif
+        }
+
+        // encrypt the current counter into buf_, then advance the block index
+
+        void next_block()
+        {
+            result_type c0 = ctr_[0], c1 = ctr_[1], c2 = ctr_[2], c3 = ctr_[3];
+            result_type k0 = key_[0], k1 = key_[1];
+
+            for (int round = 0; round < 10; ++round) {
+                result_type hi0, lo0, hi1, lo1;
+
+                mulhilo(0xD2E7470EE14C6C93ULL,c0,hi0,lo0);
+                mulhilo(0xCA5A826395121157ULL,c2,hi1,lo1);
+
+                c0 = hi1 ^ c1 ^ k0;
+                c1 = lo1;
+                c2 = hi0 ^ c3 ^ k1;
+                c3 = lo0;
+
+                k0 += 0x9E3779B97F4A7C15ULL;
+                k1 += 0xBB67AE8584CAA73BULL;
+            }
+
+            buf_[0] = c0;
+            buf_[1] = c1;
+            buf_[2] = c2;
+            buf_[3] = c3;
+
+            buf_ind_ = 0;
+            ++ctr_[0];
+        }
+};
+
+}
+
+#endif
@@ -46,23 +46,60 @@
 
 #ifndef STATS_GO_INLINE
     #define statslib_constexpr constexpr
-    #define stmath gcem
+    #define stmath stats::math
 #else
     #define statslib_constexpr inline
     #include <cmath>
     #define stmath std
 #endif
 
+// in constexpr mode, use GCEM for constant evaluation and the standard library at run time
+
+#include <type_traits>
+
+#if !defined(STATS_GO_INLINE) && !defined(STATS_DONT_USE_STD_MATH)
+    #if defined(__cpp_lib_is_constant_evaluated)
+        #define STATS_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+    #elif defined(__has_builtin)
+        #if __has_builtin(__builtin_is_constant_evaluated)
+            #define STATS_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+        #endif
+    #endif
+
+    #if !defined(STATS_IS_CONSTANT_EVALUATED) && ( (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925) )
+        #define STATS_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+
+    #ifdef STATS_IS_CONSTANT_EVALUATED
+        #define STATS_USE_STD_MATH
+        #include <cmath>
+    #endif
+#endif
+
 // RNG engine type
 
+#include "philox_engine.hpp"
+
 #ifndef STATS_RNG_ENGINE_TYPE
     #define STATS_RNG_ENGINE_TYPE std::mt19937_64
 #endif
 
+// default arguments of the r* functions: either a fresh engine seeded by std::random_device,
+// or (with STATS_USE_THREAD_LOCAL_ENGINE) a lazily initialized per-thread engine
+
+#ifdef STATS_USE_THREAD_LOCAL_ENGINE
+    #define STATS_RAND_SEED_DEFAULT
+    #define STATS_RAND_ENGINE_DEFAULT = stats::thread_local_engine()
+#else
+    #define STATS_RAND_SEED_DEFAULT = std::random_device{}()
+    #define STATS_RAND_ENGINE_DEFAULT
+#endif
+
 // include some basic libraries
 
 #include <limits>
 #include <random>
+#include <vector> // prepared samplers (alias_table)
 
 // typedefs
 
@@ -92,12 +129,62 @@ namespace stats
 
 // enable OpenMP
 
-#if defined(_OPENMP) && !defined(STATS_DONT_USE_OPENMP) && !defined(STATS_USE_OPENMP)
+#if defined(_OPENMP) && !defined(STATS_DONT_USE_OPENMP) && !defined(STATS_USE_THREAD_POOL) && !defined(STATS_USE_OPENMP)
     #define STATS_USE_OPENMP
     #include <omp.h>
+#endif
+
+// or, instead of OpenMP, run parallel loops on the built-in work-stealing thread pool (internal_fns/thread_pool.hpp),
+// with STATS_THREAD_POOL_SIZE threads in total, the calling thread included
+
+#ifdef STATS_USE_THREAD_POOL
+    #ifdef STATS_USE_OPENMP
+        #error StatsLib cannot use OpenMP and its thread pool at the same time
+    #endif
+
+    #include <atomic>
+    #include <condition_variable>
+    #include <exception>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+
+    #ifndef STATS_THREAD_POOL_SIZE
+        #define STATS_THREAD_POOL_SIZE std::thread::hardware_concurrency()
+    #endif
+#endif
+
+#if defined(STATS_USE_OPENMP) || defined(STATS_USE_THREAD_POOL)
+    #define STATS_USE_PARALLEL
+    #include <algorithm>
+
+    // loops use up to omp_get_max_threads() threads, or STATS_THREAD_POOL_SIZE with the thread pool (capped by
+    // STATS_OMP_MAX_THREADS, if defined), adding a thread only for every STATS_OMP_MIN_NS_PER_THREAD nanoseconds
+    // of estimated work; see internal_fns/omp_cost.hpp
+
+    #ifndef STATS_OMP_MIN_NS_PER_THREAD
+        #define STATS_OMP_MIN_NS_PER_THREAD ullint_t(20000)
+    #endif
+
+    // dynamically scheduled chunks of element-wise evaluation: at least STATS_OMP_MIN_NS_PER_CHUNK nanoseconds of
+    // work, and otherwise at most STATS_OMP_CHUNK_BYTES bytes of output
+
+    #ifndef STATS_OMP_MIN_NS_PER_CHUNK
+        #define STATS_OMP_MIN_NS_PER_CHUNK ullint_t(2000)
+    #endif
+
+    #ifndef STATS_OMP_CHUNK_BYTES
+        #define STATS_OMP_CHUNK_BYTES ullint_t(32768)
+    #endif
+#endif
+
+// enable background prefetching of scalar draws (rand_prefetch)
 
-    #define STATS_OMP_N_BLOCKS ullint_t(4)
-    #define STATS_OMP_MIN_N_PER_BLOCK ullint_t(4)
+#ifdef STATS_ENABLE_RAND_PREFETCH
+    #include <atomic>
+    #include <condition_variable>
+    #include <mutex>
+    #include <thread>
 #endif
 
 // enable std::vector features
@@ -192,6 +279,7 @@ namespace stats
 // other
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+    #include <algorithm> // fill, min, ...
     #include <iostream> // cerr, cout, ...
 #endif
 
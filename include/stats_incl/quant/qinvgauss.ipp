@@ -57,7 +57,7 @@ T
 qinvgauss_compute_iter_2(const T dval, const T qn, const T p, const T mu_par, const T lambda_par, const int count)
 noexcept
 {
-    return( abs(dval) < STLIM<T>::min() ? \
+    return( stmath::abs(dval) < STLIM<T>::min() ? \
                 qn :
             //
             count < STATS_QINVGAUSS_MAX_ITER ? \
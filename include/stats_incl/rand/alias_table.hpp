@@ -0,0 +1,111 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Walker alias table for sampling from a discrete distribution on {0, ..., K-1}
+ */
+
+#ifndef _statslib_alias_table_HPP
+#define _statslib_alias_table_HPP
+
+/**
+ * @brief Value returned by a draw from an empty prepared sampler, such as an \c alias_table or
+ * \c guide_table built from invalid inputs
+ */
+
+constexpr ullint_t discrete_empty_val = ~ullint_t(0);
+
+/**
+ * @brief Prepared sampler for an arbitrary discrete (categorical) distribution
+ *
+ * A table is built once from K non-negative weights in O(K) time, using Vose's method; each draw
+ * then takes a single 64-bit random number and at most one table lookup, irrespective of K.
+ * Weights need not sum to one. If any weight is negative or non-finite, or all weights are zero,
+ * the table is empty, and draws from it return \c discrete_empty_val.
+ *
+ * Example:
+ * \code{.cpp}
+ * std::vector<double> weights = {0.1, 0.2, 0.3, 0.4};
+ * stats::alias_table table(weights);
+ * stats::rand_engine_t engine(1776);
+ * stats::rdiscrete(table,engine);
+ * \endcode
+ */
+
+class alias_table
+{
+    public:
+        alias_table() = default;
+
+        /**
+         * @param weights a pointer to K category weights.
+         * @param n_weights the number of categories, K.
+         */
+
+        template<typename T>
+        alias_table(const T* weights, const ullint_t n_weights);
+
+        /**
+         * @param weights a vector of category weights.
+         */
+
+        template<typename T>
+        explicit alias_table(const std::vector<T>& weights);
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+        /**
+         * @param weights a column vector of category weights.
+         */
+
+        template<typename mT>
+        explicit alias_table(const mT& weights);
+#endif
+
+        /**
+         * @return the number of categories, or zero if the table is empty.
+         */
+
+        ullint_t size() const noexcept { return table_.size(); }
+
+        /**
+         * @return a draw from {0, ..., K-1}, or \c discrete_empty_val if the table is empty.
+         */
+
+        template<typename eT>
+        ullint_t operator()(eT& engine) const;
+
+    private:
+        // acceptance threshold (in units of 2^-64) stored next to the alias, so that a draw touches one entry
+
+        struct entry_t
+        {
+            ullint_t threshold;
+            ullint_t alias;
+        };
+
+        std::vector<entry_t> table_;
+
+        template<typename wT>
+        void build(const ullint_t n_weights, wT weight_fn);
+};
+
+#include "alias_table.ipp"
+
+#endif
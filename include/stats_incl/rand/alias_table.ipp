@@ -0,0 +1,145 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Walker alias table, built with Vose's method
+ */
+
+template<typename T>
+statslib_inline
+alias_table::alias_table(const T* weights, const ullint_t n_weights)
+{
+    build(n_weights, [weights](const ullint_t j){ return static_cast<double>(weights[j]); });
+}
+
+template<typename T>
+statslib_inline
+alias_table::alias_table(const std::vector<T>& weights)
+{
+    build(weights.size(), [&weights](const ullint_t j){ return static_cast<double>(weights[j]); });
+}
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+template<typename mT>
+statslib_inline
+alias_table::alias_table(const mT& weights)
+{
+    build(mat_ops::n_elem(weights), [&weights](const ullint_t j){ return static_cast<double>(weights(j,0)); });
+}
+#endif
+
+//
+
+template<typename wT>
+statslib_inline
+void
+alias_table::build(const ullint_t n_weights, wT weight_fn)
+{
+    table_.clear();
+
+    double weight_sum = 0.0;
+
+    for (ullint_t j = 0U; j < n_weights; ++j)
+    {
+        const double w_j = weight_fn(j);
+
+        if (!(w_j >= 0.0) || !GCINT::is_finite(w_j)) {
+            return;
+        }
+
+        weight_sum += w_j;
+    }
+
+    if (!(weight_sum > 0.0) || !GCINT::is_finite(weight_sum)) {
+        return;
+    }
+
+    // scale the weights to mean one; columns below one are topped up by an alias above one
+
+    const double scale = static_cast<double>(n_weights) / weight_sum;
+
+    std::vector<double> scaled_prob(n_weights);
+    std::vector<ullint_t> small_inds, large_inds;
+
+    for (ullint_t j = 0U; j < n_weights; ++j)
+    {
+        scaled_prob[j] = weight_fn(j) * scale;
+
+        if (scaled_prob[j] < 1.0) {
+            small_inds.push_back(j);
+        } else {
+            large_inds.push_back(j);
+        }
+    }
+
+    table_.resize(n_weights);
+
+    while (!small_inds.empty() && !large_inds.empty())
+    {
+        const ullint_t s = small_inds.back();
+        const ullint_t l = large_inds.back();
+
+        small_inds.pop_back();
+
+        table_[s].threshold = static_cast<ullint_t>( scaled_prob[s] * 18446744073709551616.0 );
+        table_[s].alias = l;
+
+        scaled_prob[l] = (scaled_prob[l] + scaled_prob[s]) - 1.0;
+
+        if (scaled_prob[l] < 1.0) {
+            large_inds.pop_back();
+            small_inds.push_back(l);
+        }
+    }
+
+    // anything left over is full, up to rounding error; point the alias at itself
+
+    for (const ullint_t j : large_inds)
+    {
+        table_[j].threshold = ~ullint_t(0);
+        table_[j].alias = j;
+    }
+
+    for (const ullint_t j : small_inds)
+    {
+        table_[j].threshold = ~ullint_t(0);
+        table_[j].alias = j;
+    }
+}
+
+// the high bits of U * K pick a column; the low bits are a uniform on [0,1) for the coin flip
+
+template<typename eT>
+statslib_inline
+ullint_t
+alias_table::operator()(eT& engine)
+const
+{
+    if (table_.empty()) {
+        return discrete_empty_val;
+    }
+
+    ullint_t col_ind, coin_bits;
+    internal::mul_u64(internal::rand_u64(engine), table_.size(), col_ind, coin_bits);
+
+    const entry_t& entry = table_[col_ind];
+
+    return( coin_bits < entry.threshold ? col_ind : entry.alias );
+}
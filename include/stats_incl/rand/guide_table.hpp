@@ -0,0 +1,120 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Guide-table inversion for sampling from a discrete distribution with fixed parameters
+ */
+
+#ifndef _statslib_guide_table_HPP
+#define _statslib_guide_table_HPP
+
+/**
+ * @brief Prepared inverse-CDF sampler for a discrete distribution with fixed parameters
+ *
+ * The cumulative distribution function is tabulated once, together with the guide index of
+ * Chen and Asau (1974). Each draw takes a single uniform and, on average, fewer than two table
+ * comparisons. Draws are exact inversions, \f$ X = \min \{ x : F(x) > U \} \f$, so they are
+ * monotone in \f$ U \f$ and can be coupled across parameter values with common random numbers.
+ *
+ * Tables for the Binomial and Poisson distributions are built with \c guide_table::binom and
+ * \c guide_table::pois, which drop tails with probability below about \f$ 10^{-30} \f$. Invalid
+ * inputs give an empty table, and draws from it return \c discrete_empty_val.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::guide_table table = stats::guide_table::pois(4.5);
+ * stats::rand_engine_t engine(1776);
+ * stats::rdiscrete(table,engine);
+ * \endcode
+ */
+
+class guide_table
+{
+    public:
+        guide_table() = default;
+
+        /**
+         * @param weights a pointer to the (unnormalized) probabilities of the values \c offset, \c offset + 1, ...
+         * @param n_weights the number of values.
+         * @param offset the smallest value of the support.
+         */
+
+        template<typename T>
+        guide_table(const T* weights, const ullint_t n_weights, const ullint_t offset = 0);
+
+        /**
+         * @param weights a vector of (unnormalized) probabilities of the values \c offset, \c offset + 1, ...
+         * @param offset the smallest value of the support.
+         */
+
+        template<typename T>
+        explicit guide_table(const std::vector<T>& weights, const ullint_t offset = 0);
+
+        /**
+         * @brief Guide table for the Binomial distribution
+         *
+         * @param n_trials_par the number of trials, a non-negative integral-valued input.
+         * @param prob_par the probability parameter, a real-valued input.
+         */
+
+        static guide_table binom(const llint_t n_trials_par, const double prob_par);
+
+        /**
+         * @brief Guide table for the Poisson distribution
+         *
+         * @param rate_par the rate parameter, a real-valued input.
+         */
+
+        static guide_table pois(const double rate_par);
+
+        /**
+         * @return the number of tabulated values, or zero if the table is empty.
+         */
+
+        ullint_t size() const noexcept { return cdf_.size(); }
+
+        /**
+         * @param unit_val a real value in [0,1).
+         *
+         * @return the smallest value \c x such that \f$ F(x) > \f$ \c unit_val, or \c discrete_empty_val if the table is empty.
+         */
+
+        ullint_t inverse(const double unit_val) const;
+
+        /**
+         * @return a draw from the tabulated distribution, or \c discrete_empty_val if the table is empty.
+         */
+
+        template<typename eT>
+        ullint_t operator()(eT& engine) const;
+
+    private:
+        ullint_t offset_ = 0;
+
+        std::vector<double> cdf_;
+        std::vector<ullint_t> guide_;
+
+        template<typename wT>
+        void build(const ullint_t n_weights, const ullint_t offset, wT weight_fn);
+};
+
+#include "guide_table.ipp"
+
+#endif
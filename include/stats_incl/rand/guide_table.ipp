@@ -0,0 +1,180 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Guide-table inversion (Chen and Asau, 1974)
+ */
+
+template<typename T>
+statslib_inline
+guide_table::guide_table(const T* weights, const ullint_t n_weights, const ullint_t offset)
+{
+    build(n_weights, offset, [weights](const ullint_t j){ return static_cast<double>(weights[j]); });
+}
+
+template<typename T>
+statslib_inline
+guide_table::guide_table(const std::vector<T>& weights, const ullint_t offset)
+{
+    build(weights.size(), offset, [&weights](const ullint_t j){ return static_cast<double>(weights[j]); });
+}
+
+// tabulate the support within 12 standard deviations (plus 12) of the mean
+
+statslib_inline
+guide_table
+guide_table::binom(const llint_t n_trials_par, const double prob_par)
+{
+    guide_table table;
+
+    if (!internal::binom_sanity_check(n_trials_par,prob_par)) {
+        return table;
+    }
+
+    const double n_d = static_cast<double>(n_trials_par);
+    const double mean_val = n_d * prob_par;
+    const double width = 12.0 * stmath::sqrt(mean_val * (1.0 - prob_par)) + 12.0;
+
+    const llint_t lower = static_cast<llint_t>( std::max(0.0, std::floor(mean_val - width)) );
+    const llint_t upper = static_cast<llint_t>( std::min(n_d, std::ceil(mean_val + width)) );
+
+    table.build(static_cast<ullint_t>(upper - lower + 1), static_cast<ullint_t>(lower),
+                [=](const ullint_t j){ return dbinom(lower + static_cast<llint_t>(j),n_trials_par,prob_par); });
+
+    return table;
+}
+
+statslib_inline
+guide_table
+guide_table::pois(const double rate_par)
+{
+    guide_table table;
+
+    if (!internal::pois_sanity_check(rate_par) || GCINT::is_inf(rate_par)) {
+        return table;
+    }
+
+    const double width = 12.0 * stmath::sqrt(rate_par) + 12.0;
+
+    const llint_t lower = static_cast<llint_t>( std::max(0.0, std::floor(rate_par - width)) );
+    const llint_t upper = static_cast<llint_t>( std::ceil(rate_par + width) );
+
+    table.build(static_cast<ullint_t>(upper - lower + 1), static_cast<ullint_t>(lower),
+                [=](const ullint_t j){ return dpois(lower + static_cast<llint_t>(j),rate_par); });
+
+    return table;
+}
+
+//
+
+template<typename wT>
+statslib_inline
+void
+guide_table::build(const ullint_t n_weights, const ullint_t offset, wT weight_fn)
+{
+    offset_ = offset;
+    cdf_.clear();
+    guide_.clear();
+
+    std::vector<double> cdf_vals(n_weights);
+
+    double weight_sum = 0.0;
+
+    for (ullint_t j = 0U; j < n_weights; ++j)
+    {
+        const double w_j = weight_fn(j);
+
+        if (!(w_j >= 0.0) || !GCINT::is_finite(w_j)) {
+            return;
+        }
+
+        weight_sum += w_j;
+        cdf_vals[j] = weight_sum;
+    }
+
+    if (!(weight_sum > 0.0) || !GCINT::is_finite(weight_sum)) {
+        return;
+    }
+
+    for (ullint_t j = 0U; j < n_weights; ++j)
+    {
+        cdf_vals[j] /= weight_sum;
+    }
+
+    // the search in inverse() stops at the last value
+
+    cdf_vals[n_weights - 1] = 1.0;
+
+    // guide_[i] is the smallest index j with F(j) > i / n_weights
+
+    guide_.resize(n_weights);
+
+    ullint_t j = 0U;
+
+    for (ullint_t i = 0U; i < n_weights; ++i)
+    {
+        const double unit_val = static_cast<double>(i) / static_cast<double>(n_weights);
+
+        while (cdf_vals[j] <= unit_val) {
+            ++j;
+        }
+
+        guide_[i] = j;
+    }
+
+    cdf_.swap(cdf_vals);
+}
+
+statslib_inline
+ullint_t
+guide_table::inverse(const double unit_val)
+const
+{
+    const ullint_t n_vals = cdf_.size();
+
+    if (n_vals == ullint_t(0)) {
+        return discrete_empty_val;
+    }
+
+    const ullint_t guide_ind = std::min(static_cast<ullint_t>(unit_val * static_cast<double>(n_vals)), n_vals - 1);
+
+    ullint_t j = guide_[guide_ind];
+
+    // the guide is a lower bound up to rounding in unit_val * n_vals; step back if it overshoots
+
+    while (j > 0U && cdf_[j-1] > unit_val) {
+        --j;
+    }
+
+    while (j + 1U < n_vals && cdf_[j] <= unit_val) {
+        ++j;
+    }
+
+    return offset_ + j;
+}
+
+template<typename eT>
+statslib_inline
+ullint_t
+guide_table::operator()(eT& engine)
+const
+{
+    return inverse( internal::u64_to_unit_co<double>(internal::rand_u64(engine)) );
+}
@@ -0,0 +1,97 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Halton low-discrepancy sequence
+ */
+
+#ifndef _statslib_halton_seq_HPP
+#define _statslib_halton_seq_HPP
+
+/**
+ * @brief Halton low-discrepancy sequence on the unit cube
+ *
+ * The j-th coordinate of the point with index i is the radical inverse of i+1 in the j-th prime base, so
+ * the origin is skipped and every coordinate lies in (0,1). Points are computed directly from their index,
+ * so seeking to a position takes constant time and a sequence can be split into parallel chunks.
+ * The Halton sequence is defined in any dimension, though the uniformity of its two-dimensional projections
+ * degrades for large prime bases; a scrambled sobol_seq is usually preferable beyond a few dozen dimensions.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::halton_seq seq(3);
+ * std::vector<double> u(100 * 3);
+ * seq.fill(u.data(), 100); // 100 points, stored point by point
+ * \endcode
+ */
+
+class halton_seq
+{
+    public:
+        halton_seq() = default;
+
+        /**
+         * @param dim_val the dimension of each point.
+         */
+
+        explicit halton_seq(const ullint_t dim_val);
+
+        /**
+         * @return the dimension of each point.
+         */
+
+        ullint_t dim() const noexcept { return bases_.size(); }
+
+        /**
+         * @return the index of the next point.
+         */
+
+        ullint_t position() const noexcept { return pos_; }
+
+        /**
+         * @param ind the index of the next point.
+         */
+
+        void seek(const ullint_t ind) noexcept { pos_ = ind; }
+
+        /**
+         * @param n_points the number of points to skip.
+         */
+
+        void discard(const ullint_t n_points) noexcept { pos_ += n_points; }
+
+        /**
+         * @param vals_out a pointer to n_points * dim() values in (0,1); the j-th coordinate of the i-th
+         * point is written to vals_out[i*dim() + j].
+         * @param n_points the number of points to generate.
+         */
+
+        template<typename T>
+        void fill(T* vals_out, const ullint_t n_points);
+
+    private:
+        ullint_t pos_ = 0;
+
+        std::vector<ullint_t> bases_;
+};
+
+#include "halton_seq.ipp"
+
+#endif
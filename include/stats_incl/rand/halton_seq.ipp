@@ -0,0 +1,86 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Halton sequence: radical inverses in the first dim prime bases
+ */
+
+statslib_inline
+halton_seq::halton_seq(const ullint_t dim_val)
+{
+    bases_.reserve(dim_val);
+
+    for (ullint_t p = 2U; bases_.size() < dim_val; ++p)
+    {
+        bool is_prime = true;
+
+        for (const ullint_t q : bases_)
+        {
+            if (q*q > p) {
+                break;
+            }
+
+            if (p % q == 0U) {
+                is_prime = false;
+                break;
+            }
+        }
+
+        if (is_prime) {
+            bases_.push_back(p);
+        }
+    }
+}
+
+template<typename T>
+statslib_inline
+void
+halton_seq::fill(T* vals_out, const ullint_t n_points)
+{
+    const ullint_t d = dim();
+
+    // radical inverses close to one can round up to one in T; these are replaced by the largest value below one
+
+    const T max_val = T(1) - STLIM<T>::epsilon() / T(2);
+
+    for (ullint_t i = 0U; i < n_points; ++i)
+    {
+        const ullint_t ind = pos_ + i + 1U;
+
+        for (ullint_t j = 0U; j < d; ++j)
+        {
+            const ullint_t base = bases_[j];
+            const double inv_base = 1.0 / static_cast<double>(base);
+
+            double val = 0.0;
+            double digit_scale = inv_base;
+
+            for (ullint_t ind_rem = ind; ind_rem > 0U; ind_rem /= base)
+            {
+                val += static_cast<double>(ind_rem % base) * digit_scale;
+                digit_scale *= inv_base;
+            }
+
+            vals_out[i*d + j] = std::min(static_cast<T>(val), max_val);
+        }
+    }
+
+    pos_ += n_points;
+}
@@ -0,0 +1,84 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Transform the points of a low-discrepancy sequence into draws from a target distribution
+ */
+
+#ifndef _statslib_qmc_fill_HPP
+#define _statslib_qmc_fill_HPP
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+namespace internal
+{
+
+template<typename sT>
+struct is_qmc_seq : std::false_type {};
+
+template<>
+struct is_qmc_seq<sobol_seq> : std::true_type {};
+
+template<>
+struct is_qmc_seq<halton_seq> : std::true_type {};
+
+}
+
+/**
+ * @brief Quasi-Monte Carlo matrix sampling function
+ *
+ * @param n the number of points, i.e., the number of output rows.
+ * @param seq a low-discrepancy sequence, \c sobol_seq or \c halton_seq, passed by reference; it is advanced by \c n points.
+ * @param quantile_fn a function that maps a value in (0,1) to the target distribution, such as a quantile function.
+ * @param cost_ns an estimate of the time taken by one call to \c quantile_fn, in nanoseconds, used to decide how many threads to use;
+ * defaults to \c STATS_OMP_COST_qmc_quantile (100); see internal_fns/omp_cost.hpp for the StatsLib quantile functions.
+ *
+ * @return an \c n by \c seq.dim() matrix whose i-th row is the next point of \c seq, with \c quantile_fn applied to each coordinate.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::sobol_seq seq(4, true, 1776);
+ * // std::vector
+ * stats::qmc_fill<std::vector<double>>(1024,seq,[](double u){ return stats::qnorm(u); });
+ * // Armadillo matrix
+ * stats::qmc_fill<arma::mat>(1024,seq,[](double u){ return stats::qgamma(u,2.0,1.0); });
+ * // Blaze dynamic matrix
+ * stats::qmc_fill<blaze::DynamicMatrix<double,blaze::columnMajor>>(1024,seq,[](double u){ return stats::qbeta(u,2.0,3.0); },900000);
+ * // Eigen dynamic matrix
+ * stats::qmc_fill<Eigen::MatrixXd>(1024,seq,[](double u){ return stats::qexp(u,2.0); });
+ * \endcode
+ *
+ * @note The points are generated in parallel chunks when OpenMP is enabled, so \c quantile_fn may be called concurrently; 
+ * each chunk seeks to its own position in the sequence, so the output does not depend on the number of threads.
+ */
+
+template<typename mT, typename sT, typename fT>
+statslib_inline
+mT
+qmc_fill(const ullint_t n, sT& seq, fT quantile_fn, const ullint_t cost_ns = STATS_OMP_COST_qmc_quantile);
+
+//
+// include implementation files
+
+#include "qmc_fill.ipp"
+
+#endif
+
+#endif
@@ -0,0 +1,130 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Transform the points of a low-discrepancy sequence into draws from a target distribution
+ */
+
+namespace internal
+{
+
+// point_fn(i, u) is called for each of the next n_points points of seq, with the coordinates of point i
+// held in u[0], ..., u[dim-1], at an estimated cost of cost_ns nanoseconds per point. Each chunk generates
+// its points from a copy of seq, moved to the start of the chunk, so the result does not depend on how the
+// work is split; seq is advanced by n_points. u points into the chunk's own buffer, so point_fn may
+// overwrite it.
+
+template<typename T, typename sT, typename fT>
+statslib_inline
+void
+qmc_run_vec(const ullint_t n_points, sT& seq, fT point_fn, const ullint_t cost_ns)
+{
+    const ullint_t d = seq.dim();
+    const ullint_t pos_0 = seq.position();
+
+#ifdef STATS_USE_PARALLEL
+    const ullint_t n_chunks = omp_n_threads_cost(n_points,cost_ns,ullint_t(0));
+#else
+    const ullint_t n_chunks = 1U;
+    STATS_UNUSED_PAR(cost_ns);
+#endif
+
+    omp_run(n_chunks, n_chunks, [&](const ullint_t c)
+    {
+        const ullint_t chunk_begin = omp_block_begin(c,n_chunks,n_points);
+        const ullint_t chunk_end = omp_block_begin(c+1U,n_chunks,n_points);
+
+        sT seq_c = seq;
+        seq_c.seek(pos_0 + chunk_begin);
+
+        std::vector<T> unit_vals(STATS_RAND_UNIT_BLOCK_SIZE * d);
+
+        for (ullint_t i0 = chunk_begin; i0 < chunk_end; i0 += STATS_RAND_UNIT_BLOCK_SIZE)
+        {
+            const ullint_t n_block = std::min(STATS_RAND_UNIT_BLOCK_SIZE, chunk_end - i0);
+
+            seq_c.fill(unit_vals.data(), n_block);
+
+            for (ullint_t i = 0U; i < n_block; ++i) {
+                point_fn(i0 + i, unit_vals.data() + i*d);
+            }
+        }
+    });
+
+    seq.seek(pos_0 + n_points);
+}
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename sT, typename fT>
+statslib_inline
+void
+qmc_fill_check(std::vector<eT>& X, const ullint_t n, sT& seq, fT& quantile_fn, const ullint_t cost_ns)
+{
+    const ullint_t d = seq.dim();
+    eT* vals_out = X.data();
+
+    qmc_run_vec<eT>(n,seq,
+        [&](const ullint_t i, const eT* unit_vals)
+        {
+            for (ullint_t j = 0U; j < d; ++j) {
+                vals_out[j*n + i] = quantile_fn(unit_vals[j]);
+            }
+        },
+        d*cost_ns);
+}
+#endif
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+template<typename mT, typename sT, typename fT>
+statslib_inline
+void
+qmc_fill_check(mT& X, const ullint_t n, sT& seq, fT& quantile_fn, const ullint_t cost_ns)
+{
+    typedef typename std::decay<decltype(X(0,0))>::type eT;
+
+    const ullint_t d = seq.dim();
+
+    qmc_run_vec<eT>(n,seq,
+        [&](const ullint_t i, const eT* unit_vals)
+        {
+            for (ullint_t j = 0U; j < d; ++j) {
+                X(i,j) = quantile_fn(unit_vals[j]);
+            }
+        },
+        d*cost_ns);
+}
+#endif
+
+}
+
+template<typename mT, typename sT, typename fT>
+statslib_inline
+mT
+qmc_fill(const ullint_t n, sT& seq, fT quantile_fn, const ullint_t cost_ns)
+{
+    static_assert(internal::is_qmc_seq<sT>::value, "qmc_fill: seq must be a sobol_seq or a halton_seq");
+
+    mT mat_out;
+    mat_ops::resize(mat_out,n,seq.dim());
+
+    internal::qmc_fill_check(mat_out,n,seq,quantile_fn,cost_ns);
+
+    return mat_out;
+}
@@ -21,21 +21,32 @@
 #ifndef _statslib_rand_HPP
 #define _statslib_rand_HPP
 
+#include "rand_mode.hpp"
+
 #include "runif.hpp"
+#include "ziggurat.hpp"
 #include "rnorm.hpp"
+#include "rand_prefetch.hpp"
 
 #include "rgamma.hpp"
 
+#include "alias_table.hpp"
+#include "guide_table.hpp"
+
+#include "sobol_seq.hpp"
+#include "halton_seq.hpp"
+#include "qmc_fill.hpp"
+
 #include "rbern.hpp"
 #include "rbeta.hpp"
 #include "rbinom.hpp"
 #include "rcauchy.hpp"
 #include "rchisq.hpp"
+#include "rdiscrete.hpp"
 #include "rexp.hpp"
 #include "rf.hpp"
 #include "rinvgamma.hpp"
 #include "rinvgauss.hpp"
-#include "rinvwish.hpp"
 #include "rlaplace.hpp"
 #include "rlnorm.hpp"
 #include "rlogis.hpp"
@@ -47,4 +58,6 @@
 #include "rweibull.hpp"
 #include "rwish.hpp"
 
+#include "rinvwish.hpp"
+
 #endif
@@ -0,0 +1,162 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Variance-reduced sampling modes for inversion samplers
+ */
+
+#ifndef _statslib_rand_mode_HPP
+#define _statslib_rand_mode_HPP
+
+/**
+ * @brief Sampling modes for the matrix output of inversion-based samplers
+ *
+ * Each column of an n x k output is generated from its own set of n uniform draws:
+ *
+ * - \c standard: n independent draws.
+ * - \c antithetic: draws u_1, ..., u_m, with m = floor(n/2), fill rows 1 to m, and rows m+1 to 2m use 1 - u_1, ..., 1 - u_m;
+ *   with n odd, the last row is an independent draw. Row i + m is thus the antithetic partner of row i in every column,
+ *   and only half of the uniform draws are taken from the engine.
+ * - \c stratified: one draw from each of the n strata ((i-1)/n, i/n), in random order, with independent orderings across
+ *   columns; i.e., the rows form a Latin hypercube sample.
+ *
+ * In each case every element has the target marginal distribution.
+ */
+
+enum class rand_mode
+{
+    standard,
+    antithetic,
+    stratified
+};
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+namespace internal
+{
+
+// column_fn(j, unit_vals) is called with the n_rows uniform values of column j; cost_ns estimates the time
+// to produce one element
+
+template<typename T, typename fT>
+statslib_inline
+void
+rand_mode_run(const ullint_t n_rows, const ullint_t n_cols, const rand_mode mode, rand_engine_t& engine_0, fT column_fn, const ullint_t cost_ns)
+{
+    // (s + v)/n can round up to one for the last stratum
+
+    const T max_val = T(1) - STLIM<T>::epsilon() / T(2);
+
+    rand_run_vec(n_cols,engine_0,
+        [&](const ullint_t j, rand_engine_t& engine_j)
+        {
+            std::vector<T> unit_vals(n_rows);
+
+            if (mode == rand_mode::antithetic)
+            {
+                const ullint_t n_half = n_rows / 2U;
+
+                fill_unit_oo(engine_j,unit_vals.data(),n_half);
+
+                for (ullint_t i = 0U; i < n_half; ++i) {
+                    unit_vals[n_half + i] = T(1) - unit_vals[i];
+                }
+
+                fill_unit_oo(engine_j,unit_vals.data() + 2U*n_half,n_rows - 2U*n_half);
+            }
+            else if (mode == rand_mode::stratified)
+            {
+                fill_unit_oo(engine_j,unit_vals.data(),n_rows);
+
+                // Fisher-Yates shuffle of the strata
+
+                std::vector<ullint_t> strata(n_rows);
+
+                for (ullint_t i = 0U; i < n_rows; ++i) {
+                    strata[i] = i;
+                }
+
+                for (ullint_t i = n_rows; i > 1U; --i)
+                {
+                    ullint_t swap_ind, lo_bits;
+                    mul_u64(rand_u64(engine_j),i,swap_ind,lo_bits);
+
+                    std::swap(strata[i-1],strata[swap_ind]);
+                }
+
+                const T inv_n = T(1) / static_cast<T>(n_rows);
+
+                for (ullint_t i = 0U; i < n_rows; ++i) {
+                    unit_vals[i] = std::min((static_cast<T>(strata[i]) + unit_vals[i]) * inv_n, max_val);
+                }
+            }
+            else
+            {
+                fill_unit_oo(engine_j,unit_vals.data(),n_rows);
+            }
+
+            column_fn(j,unit_vals.data());
+        },
+        n_rows*cost_ns);
+}
+
+// std::vector output is stored column by column
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename T, typename eT, typename fT>
+statslib_inline
+void
+rand_mode_fill(std::vector<eT>& X, const ullint_t n, const ullint_t k, const rand_mode mode, rand_engine_t& engine, fT transform_fn, const ullint_t cost_ns)
+{
+    eT* vals_out = X.data();
+
+    rand_mode_run<T>(n,k,mode,engine,
+        [&](const ullint_t j, const T* unit_vals)
+        {
+            for (ullint_t i = 0U; i < n; ++i) {
+                vals_out[j*n + i] = transform_fn(unit_vals[i]);
+            }
+        },
+        cost_ns);
+}
+#endif
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+template<typename T, typename mT, typename fT>
+statslib_inline
+void
+rand_mode_fill(mT& X, const ullint_t n, const ullint_t k, const rand_mode mode, rand_engine_t& engine, fT transform_fn, const ullint_t cost_ns)
+{
+    rand_mode_run<T>(n,k,mode,engine,
+        [&](const ullint_t j, const T* unit_vals)
+        {
+            for (ullint_t i = 0U; i < n; ++i) {
+                X(i,j) = transform_fn(unit_vals[i]);
+            }
+        },
+        cost_ns);
+}
+#endif
+
+}
+
+#endif
+
+#endif
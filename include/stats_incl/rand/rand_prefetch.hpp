@@ -0,0 +1,223 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Background prefetching of uniform and normal draws for scalar sampling
+ */
+
+#ifndef _statslib_rand_prefetch_HPP
+#define _statslib_rand_prefetch_HPP
+
+#ifdef STATS_ENABLE_RAND_PREFETCH
+
+namespace internal
+{
+
+// bounded single-producer/single-consumer ring; head_ and tail_ count all pops and pushes,
+// and the capacity is a power of two
+
+template<typename T>
+class spsc_ring
+{
+    public:
+        explicit spsc_ring(const ullint_t capacity) : buf_(capacity), mask_(capacity - 1U) {}
+
+        ullint_t capacity() const noexcept { return buf_.size(); }
+
+        ullint_t free_slots() const noexcept
+        {
+            return capacity() - (tail_.load(std::memory_order_relaxed) - head_.load());
+        }
+
+        // producer side
+
+        void push(const T* vals, const ullint_t n_vals)
+        {
+            const ullint_t tail = tail_.load(std::memory_order_relaxed);
+
+            for (ullint_t i = 0U; i < n_vals; ++i) {
+                buf_[(tail + i) & mask_] = vals[i];
+            }
+
+            tail_.store(tail + n_vals, std::memory_order_release);
+        }
+
+        // consumer side; head_ is stored sequentially consistent so that a sleeping producer is either
+        // seen by the consumer or sees the freed slot itself
+
+        bool pop(T& val)
+        {
+            const ullint_t head = head_.load(std::memory_order_relaxed);
+
+            if (head == tail_.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            val = buf_[head & mask_];
+            head_.store(head + 1U);
+
+            return true;
+        }
+
+    private:
+        std::vector<T> buf_;
+        const ullint_t mask_;
+
+        std::atomic<ullint_t> head_{0};
+        char pad_[64];                  // keep the two indices on separate cache lines
+        std::atomic<ullint_t> tail_{0};
+};
+
+}
+
+/**
+ * @brief Background producer of uniform and normal draws for scalar sampling
+ *
+ * A worker thread fills two bounded rings, one of uniform bits and one of standard normal draws, and
+ * the scalar \c runif and \c rnorm overloads that take a \c rand_prefetch consume from them, so that engine
+ * stepping and the Ziggurat method are taken off the caller's critical path. Each ring has its own engine,
+ * <tt>stream_engine(seed_val,0)</tt> and <tt>stream_engine(seed_val,1)</tt>, so both streams of draws depend
+ * only on the seed value, and not on how calls to the two functions are interleaved or on thread timing.
+ *
+ * The worker refills a ring in chunks while it has room, and sleeps once both rings are nearly full until
+ * one of them is half empty. Draws are consumed by a single thread: the object must not be shared by
+ * concurrent callers. The destructor stops and joins the worker.
+ *
+ * Requires \c STATS_ENABLE_RAND_PREFETCH to be defined before including StatsLib.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_prefetch prefetch(1776);
+ * double z = stats::rnorm(1.0,2.0,prefetch);
+ * double u = stats::runif(0.0,1.0,prefetch);
+ * \endcode
+ */
+
+class rand_prefetch
+{
+    public:
+        /**
+         * @param seed_val the seed value of both streams.
+         * @param capacity_val the number of draws held by each ring; rounded up to a power of two, and at least 128.
+         */
+
+        explicit rand_prefetch(const ullint_t seed_val, const ullint_t capacity_val = 4096);
+
+        ~rand_prefetch();
+
+        rand_prefetch(const rand_prefetch&) = delete;
+        rand_prefetch& operator=(const rand_prefetch&) = delete;
+
+        /**
+         * @return the number of draws held by each ring.
+         */
+
+        ullint_t capacity() const noexcept { return unif_ring_.capacity(); }
+
+        /**
+         * @return the next draw of the uniform stream, in (0,1).
+         */
+
+        template<typename T = double>
+        T unif();
+
+        /**
+         * @return the next draw of the standard normal stream.
+         */
+
+        template<typename T = double>
+        T norm();
+
+    private:
+        static ullint_t ring_capacity(const ullint_t capacity_val) noexcept;
+
+        template<typename T>
+        T pop_wait(internal::spsc_ring<T>& ring);
+
+        bool refill_ready() const noexcept;
+        void produce();
+
+        static constexpr ullint_t chunk_size_ = 64;
+
+        rand_engine_t unif_engine_;
+        rand_engine_t norm_engine_;
+
+        internal::spsc_ring<ullint_t> unif_ring_;
+        internal::spsc_ring<double> norm_ring_;
+
+        std::atomic<bool> stop_{false};
+        std::atomic<bool> idle_{false};
+
+        std::mutex idle_mutex_;
+        std::condition_variable idle_cv_;
+
+        std::thread worker_;
+};
+
+//
+// scalar output
+
+/**
+ * @brief Random sampling function for the Uniform distribution
+ *
+ * @param a_par the lower bound parameter, a real-valued input.
+ * @param b_par the upper bound parameter, a real-valued input.
+ * @param prefetch a prefetch buffer, passed by reference.
+ *
+ * @return a pseudo-random draw from the Uniform distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_prefetch prefetch(1776);
+ * stats::runif(3.0,2.0,prefetch);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+runif(const T1 a_par, const T2 b_par, rand_prefetch& prefetch);
+
+/**
+ * @brief Random sampling function for the Normal distribution
+ *
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param prefetch a prefetch buffer, passed by reference.
+ *
+ * @return a pseudo-random draw from the Normal distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_prefetch prefetch(1776);
+ * stats::rnorm(1.0,2.0,prefetch);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rnorm(const T1 mu_par, const T2 sigma_par, rand_prefetch& prefetch);
+
+#include "rand_prefetch.ipp"
+
+#endif
+
+#endif
@@ -0,0 +1,204 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Background prefetching of uniform and normal draws for scalar sampling
+ */
+
+statslib_inline
+rand_prefetch::rand_prefetch(const ullint_t seed_val, const ullint_t capacity_val)
+    : unif_engine_(stream_engine(seed_val,0U)),
+      norm_engine_(stream_engine(seed_val,1U)),
+      unif_ring_(ring_capacity(capacity_val)),
+      norm_ring_(ring_capacity(capacity_val))
+{
+    worker_ = std::thread(&rand_prefetch::produce, this);
+}
+
+statslib_inline
+rand_prefetch::~rand_prefetch()
+{
+    {
+        std::lock_guard<std::mutex> lock(idle_mutex_);
+        stop_.store(true);
+    }
+
+    idle_cv_.notify_one();
+    worker_.join();
+}
+
+statslib_inline
+ullint_t
+rand_prefetch::ring_capacity(const ullint_t capacity_val)
+noexcept
+{
+    ullint_t ring_cap = 2U * chunk_size_;
+
+    while (ring_cap < capacity_val) {
+        ring_cap <<= 1;
+    }
+
+    return ring_cap;
+}
+
+template<typename T>
+statslib_inline
+T
+rand_prefetch::unif()
+{
+    return internal::u64_to_unit_oo<T>(pop_wait(unif_ring_));
+}
+
+template<typename T>
+statslib_inline
+T
+rand_prefetch::norm()
+{
+    return static_cast<T>(pop_wait(norm_ring_));
+}
+
+template<typename T>
+statslib_inline
+T
+rand_prefetch::pop_wait(internal::spsc_ring<T>& ring)
+{
+    T val;
+
+    while (!ring.pop(val)) {
+        std::this_thread::yield();
+    }
+
+    // the worker only sleeps while each ring holds at least capacity - chunk_size_ draws, so it is
+    // woken here before this ring can run empty
+
+    if (idle_.load() && ring.free_slots() >= ring.capacity() / 2U) {
+        std::lock_guard<std::mutex> lock(idle_mutex_);
+        idle_cv_.notify_one();
+    }
+
+    return val;
+}
+
+statslib_inline
+bool
+rand_prefetch::refill_ready()
+const
+noexcept
+{
+    return unif_ring_.free_slots() >= unif_ring_.capacity() / 2U || norm_ring_.free_slots() >= norm_ring_.capacity() / 2U;
+}
+
+statslib_inline
+void
+rand_prefetch::produce()
+{
+    ullint_t unif_vals[chunk_size_];
+    double norm_vals[chunk_size_];
+
+    while (!stop_.load())
+    {
+        bool filled = false;
+
+        if (unif_ring_.free_slots() >= chunk_size_)
+        {
+            for (ullint_t i = 0U; i < chunk_size_; ++i) {
+                unif_vals[i] = internal::rand_u64(unif_engine_);
+            }
+
+            unif_ring_.push(unif_vals, chunk_size_);
+            filled = true;
+        }
+
+        if (norm_ring_.free_slots() >= chunk_size_)
+        {
+            for (ullint_t i = 0U; i < chunk_size_; ++i) {
+                norm_vals[i] = internal::zig_norm<double>(norm_engine_);
+            }
+
+            norm_ring_.push(norm_vals, chunk_size_);
+            filled = true;
+        }
+
+        if (!filled)
+        {
+            // idle_ is set before the rings are re-checked, and a consumer frees a slot before reading idle_,
+            // so a wake-up cannot be missed
+
+            std::unique_lock<std::mutex> lock(idle_mutex_);
+
+            idle_.store(true);
+            idle_cv_.wait(lock, [this] { return stop_.load() || refill_ready(); });
+            idle_.store(false);
+        }
+    }
+}
+
+//
+// scalar output
+
+namespace internal
+{
+
+template<typename T>
+statslib_inline
+T
+runif_compute(const T a_par, const T b_par, rand_prefetch& prefetch)
+{
+    if (!unif_sanity_check(a_par,b_par)) {
+        return STLIM<T>::quiet_NaN();
+    }
+
+    T lo_val, hi_val;
+    runif_bounds(a_par,b_par,lo_val,hi_val);
+
+    return runif_from_unit(prefetch.unif<T>(),a_par,b_par,lo_val,hi_val);
+}
+
+template<typename T>
+statslib_inline
+T
+rnorm_compute(const T mu_par, const T sigma_par, rand_prefetch& prefetch)
+{
+    if (!norm_sanity_check(mu_par,sigma_par)) {
+        return STLIM<T>::quiet_NaN();
+    }
+
+    return mu_par + sigma_par*prefetch.norm<T>();
+}
+
+}
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+runif(const T1 a_par, const T2 b_par, rand_prefetch& prefetch)
+{
+    typedef common_return_t<T1,T2> TC;
+    return internal::runif_compute(static_cast<TC>(a_par),static_cast<TC>(b_par),prefetch);
+}
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rnorm(const T1 mu_par, const T2 sigma_par, rand_prefetch& prefetch)
+{
+    typedef common_return_t<T1,T2> TC;
+    return internal::rnorm_compute(static_cast<TC>(mu_par),static_cast<TC>(sigma_par),prefetch);
+}
@@ -46,7 +46,7 @@
 template<typename T>
 statslib_inline
 return_t<T> 
-rbern(const T prob_par, rand_engine_t& engine);
+rbern(const T prob_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Bernoulli distribution
@@ -65,7 +65,7 @@ rbern(const T prob_par, rand_engine_t& engine);
 template<typename T>
 statslib_inline
 return_t<T>
-rbern(const T prob_par, const ullint_t seed_val = std::random_device{}());
+rbern(const T prob_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -101,7 +101,7 @@ rbern(const T prob_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rbern(const ullint_t n, const ullint_t k, const T1 prob_par, rand_engine_t& engine);
+rbern(const ullint_t n, const ullint_t k, const T1 prob_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the Bernoulli distribution
@@ -131,7 +131,7 @@ rbern(const ullint_t n, const ullint_t k, const T1 prob_par, rand_engine_t& engi
 template<typename mT, typename T1>
 statslib_inline
 mT
-rbern(const ullint_t n, const ullint_t k, const T1 prob_par, const ullint_t seed_val = std::random_device{}());
+rbern(const ullint_t n, const ullint_t k, const T1 prob_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rbeta(const T1 a_par, const T2 b_par, rand_engine_t& engine);
+rbeta(const T1 a_par, const T2 b_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Beta distribution
@@ -67,7 +67,7 @@ rbeta(const T1 a_par, const T2 b_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rbeta(const T1 a_par, const T2 b_par, const ullint_t seed_val = std::random_device{}());
+rbeta(const T1 a_par, const T2 b_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,7 @@ rbeta(const T1 a_par, const T2 b_par, const ullint_t seed_val = std::random_devi
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rand_engine_t& engine);
+rbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the Beta distribution
@@ -135,7 +135,7 @@ rbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rand_e
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, const ullint_t seed_val = std::random_device{}());
+rbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
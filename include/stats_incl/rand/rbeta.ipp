@@ -20,6 +20,10 @@
 
 /* 
  * Sample from a Beta distribution
+ *
+ * max(a,b) <= 1:     Johnk (1964)
+ * min(a,b) > 1:      Cheng (1978), algorithm BB
+ * otherwise:         Cheng (1978), algorithm BC
  */
 
 //
@@ -28,6 +32,224 @@
 namespace internal
 {
 
+enum class rbeta_method_t { johnk, cheng_bb, cheng_bc, degenerate };
+
+// constants that depend only on (a, b); computed once per parameter pair.
+// In Cheng's notation, a_ch and b_ch are the parameters reordered for the chosen algorithm.
+
+template<typename T>
+struct rbeta_setup_t
+{
+    rbeta_method_t method;
+
+    T a_par;
+    T b_par;
+
+    T a_ch;
+    T b_ch;
+    bool flip;      // return b_ch / (b_ch + W) rather than W / (b_ch + W)
+
+    T alpha;
+    T beta;
+    T gamma;        // BB
+    T k1, k2;       // BC
+
+    T degen_val;
+};
+
+template<typename T>
+statslib_inline
+rbeta_setup_t<T>
+rbeta_setup(const T a_par, const T b_par)
+{
+    rbeta_setup_t<T> st;
+
+    st.a_par = a_par;
+    st.b_par = b_par;
+
+    // limiting cases: all mass at 0 or 1
+
+    if (a_par == T(0) || b_par == T(0) || GCINT::is_posinf(a_par) || GCINT::is_posinf(b_par)) {
+        st.method = rbeta_method_t::degenerate;
+        st.degen_val = ( (a_par == T(0) && b_par == T(0)) || (GCINT::is_posinf(a_par) && GCINT::is_posinf(b_par)) ) ? \
+                            STLIM<T>::quiet_NaN() :
+                       (a_par == T(0) || GCINT::is_posinf(b_par)) ? T(0) : T(1);
+        return st;
+    }
+
+    const T min_par = std::min(a_par,b_par);
+    const T max_par = std::max(a_par,b_par);
+
+    st.alpha = a_par + b_par;
+
+    if (max_par <= T(1)) {
+        st.method = rbeta_method_t::johnk;
+    } else if (min_par > T(1)) {
+        st.method = rbeta_method_t::cheng_bb;
+
+        st.a_ch = min_par;
+        st.b_ch = max_par;
+        st.flip = (a_par != min_par);
+
+        st.beta = std::sqrt( (st.alpha - T(2)) / (T(2)*st.a_ch*st.b_ch - st.alpha) );
+        st.gamma = st.a_ch + T(1) / st.beta;
+    } else {
+        st.method = rbeta_method_t::cheng_bc;
+
+        st.a_ch = max_par;
+        st.b_ch = min_par;
+        st.flip = (a_par != max_par);
+
+        st.beta = T(1) / st.b_ch;
+
+        const T delta = T(1) + st.a_ch - st.b_ch;
+
+        st.k1 = delta * (T(0.0138889) + T(0.0416667)*st.b_ch) / (st.a_ch*st.beta - T(0.777778));
+        st.k2 = T(0.25) + (T(0.5) + T(0.25)/delta) * st.b_ch;
+    }
+
+    return st;
+}
+
+// W = scale * exp(V), with V = beta * log(U / (1 - U)), capped at the largest finite value
+
+template<typename T>
+statslib_inline
+void
+rbeta_cheng_vw(const T u_1, const T beta, const T scale, T& V, T& W)
+{
+    V = beta * std::log(u_1 / (T(1) - u_1));
+    W = scale * std::exp(V);
+
+    if (!(W < STLIM<T>::max())) {
+        W = STLIM<T>::max();
+    }
+}
+
+template<typename T>
+statslib_inline
+T
+rbeta_johnk(const rbeta_setup_t<T>& st, rand_engine_t& engine)
+{
+    while (true) {
+        // log(U) = -E for E a standard exponential draw
+
+        const T log_X = - zig_exp<T>(engine) / st.a_par;
+        const T log_Y = - zig_exp<T>(engine) / st.b_par;
+
+        const T X = std::exp(log_X);
+        const T Y = std::exp(log_Y);
+        const T XpY = X + Y;
+
+        if (XpY <= T(1)) {
+            if (XpY > T(0)) {
+                return X / XpY;
+            }
+
+            // both terms underflow; compute X / (X + Y) on the log scale
+
+            const T log_M = std::max(log_X,log_Y);
+
+            return std::exp( (log_X - log_M) - std::log(std::exp(log_X - log_M) + std::exp(log_Y - log_M)) );
+        }
+    }
+}
+
+template<typename T>
+statslib_inline
+T
+rbeta_cheng_bb(const rbeta_setup_t<T>& st, rand_engine_t& engine)
+{
+    T V, W;
+
+    while (true) {
+        const T u_1 = u64_to_unit_oo<T>(rand_u64(engine));
+        const T u_2 = u64_to_unit_oo<T>(rand_u64(engine));
+
+        rbeta_cheng_vw(u_1,st.beta,st.a_ch,V,W);
+
+        const T Z = u_1 * u_1 * u_2;
+        const T R = st.gamma * V - T(1.3862944);
+        const T S = st.a_ch + R - W;
+
+        if (S + T(2.609438) >= T(5)*Z) {
+            break;
+        }
+
+        const T log_Z = std::log(Z);
+
+        if (S > log_Z) {
+            break;
+        }
+
+        if (R + st.alpha * std::log(st.alpha / (st.b_ch + W)) >= log_Z) {
+            break;
+        }
+    }
+
+    return st.flip ? st.b_ch / (st.b_ch + W) : W / (st.b_ch + W);
+}
+
+template<typename T>
+statslib_inline
+T
+rbeta_cheng_bc(const rbeta_setup_t<T>& st, rand_engine_t& engine)
+{
+    T V, W;
+
+    while (true) {
+        const T u_1 = u64_to_unit_oo<T>(rand_u64(engine));
+        const T u_2 = u64_to_unit_oo<T>(rand_u64(engine));
+
+        T Z;
+
+        if (u_1 < T(0.5)) {
+            const T Y = u_1 * u_2;
+            Z = u_1 * Y;
+
+            if (T(0.25)*u_2 + Z - Y >= st.k1) {
+                continue;
+            }
+        } else {
+            Z = u_1 * u_1 * u_2;
+
+            if (Z <= T(0.25)) {
+                rbeta_cheng_vw(u_1,st.beta,st.a_ch,V,W);
+                break;
+            }
+
+            if (Z >= st.k2) {
+                continue;
+            }
+        }
+
+        rbeta_cheng_vw(u_1,st.beta,st.a_ch,V,W);
+
+        if (st.alpha * (std::log(st.alpha / (st.b_ch + W)) + V) - T(1.3862944) >= std::log(Z)) {
+            break;
+        }
+    }
+
+    return st.flip ? st.b_ch / (st.b_ch + W) : W / (st.b_ch + W);
+}
+
+template<typename T>
+statslib_inline
+T
+rbeta_draw(const rbeta_setup_t<T>& st, rand_engine_t& engine)
+{
+    switch (st.method) {
+        case rbeta_method_t::johnk:
+            return rbeta_johnk(st,engine);
+        case rbeta_method_t::cheng_bb:
+            return rbeta_cheng_bb(st,engine);
+        case rbeta_method_t::cheng_bc:
+            return rbeta_cheng_bc(st,engine);
+        default:
+            return st.degen_val;
+    }
+}
+
 template<typename T>
 statslib_inline
 T
@@ -38,11 +260,8 @@ rbeta_compute(const T a_par, const T b_par, rand_engine_t& engine)
     }
 
     //
-    
-    const T X = rgamma(a_par,T(1),engine);
-    const T Y = rgamma(b_par,T(1),engine);
-    
-    return X / (X + Y);
+
+    return rbeta_draw(rbeta_setup(a_par,b_par),engine);
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -85,7 +304,20 @@ void
 rbeta_vec(const T1 a_par, const T2 b_par, rand_engine_t& engine_0, 
           rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rbeta,vals_out,num_elem,engine_0,a_par,b_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!beta_sanity_check(static_cast<TC>(a_par),static_cast<TC>(b_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    // setup is computed once and shared by all draws in the batch
+
+    const rbeta_setup_t<TC> st = rbeta_setup(static_cast<TC>(a_par),static_cast<TC>(b_par));
+
+    RAND_DIST_FN_VEC(rbeta_draw,vals_out,num_elem,engine_0,st);
 }
 #endif
 
@@ -47,7 +47,7 @@
 template<typename T>
 statslib_inline
 return_t<T>
-rbinom(const llint_t n_trials_par, const T prob_par, rand_engine_t& engine);
+rbinom(const llint_t n_trials_par, const T prob_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Binomial distribution
@@ -67,7 +67,7 @@ rbinom(const llint_t n_trials_par, const T prob_par, rand_engine_t& engine);
 template<typename T>
 statslib_inline
 return_t<T>
-rbinom(const llint_t n_trials_par, const T prob_par, const ullint_t seed_val = std::random_device{}());
+rbinom(const llint_t n_trials_par, const T prob_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,7 @@ rbinom(const llint_t n_trials_par, const T prob_par, const ullint_t seed_val = s
 template<typename mT, typename T1>
 statslib_inline
 mT
-rbinom(const ullint_t n, const ullint_t k, const llint_t n_trials_par, const T1 prob_par, rand_engine_t& engine);
+rbinom(const ullint_t n, const ullint_t k, const llint_t n_trials_par, const T1 prob_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the Binomial distribution
@@ -135,7 +135,7 @@ rbinom(const ullint_t n, const ullint_t k, const llint_t n_trials_par, const T1
 template<typename mT, typename T1>
 statslib_inline
 mT
-rbinom(const ullint_t n, const ullint_t k, const llint_t n_trials_par, const T1 prob_par, const ullint_t seed_val = std::random_device{}());
+rbinom(const ullint_t n, const ullint_t k, const llint_t n_trials_par, const T1 prob_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
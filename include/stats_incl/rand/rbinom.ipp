@@ -20,30 +20,245 @@
 
 /*
  * Sample from a Binomial distribution
+ *
+ * For n * min(p,1-p) < 30, sequential inversion (BINV) is used; otherwise,
+ * the BTPE algorithm of Kachitvichyanukul and Schmeiser (1988) is used.
+ * Both are defined for p <= 0.5, with the result reflected when p > 0.5.
  */
 
 //
 // scalar output
 
+namespace internal
+{
+
+// constants that depend only on (n, p); computed once per parameter pair
+
+struct rbinom_setup_t
+{
+    llint_t n_trials;
+    bool flip;      // p > 0.5: sample with 1-p and return n - x
+    bool use_btpe;
+
+    double r;       // min(p, 1-p)
+    double q;       // 1 - r
+
+    // inversion
+    double qn;
+    double bound;
+
+    // BTPE
+    double nrq, fm, m, p1, xm, xl, xr, c, laml, lamr, p2, p3, p4;
+};
+
+statslib_inline
+rbinom_setup_t
+rbinom_setup(const llint_t n_trials_par, const double prob_par)
+{
+    rbinom_setup_t st;
+
+    st.n_trials = n_trials_par;
+    st.flip = prob_par > 0.5;
+    st.r = st.flip ? 1.0 - prob_par : prob_par;
+    st.q = 1.0 - st.r;
+
+    const double n_d = static_cast<double>(n_trials_par);
+
+    st.use_btpe = (n_d * st.r >= 30.0);
+
+    if (!st.use_btpe) {
+        const double np = n_d * st.r;
+
+        st.qn = stmath::exp(n_d * stmath::log(st.q));
+        st.bound = std::min(n_d, np + 10.0 * stmath::sqrt(np * st.q + 1.0));
+    } else {
+        st.nrq = n_d * st.r * st.q;
+        st.fm = n_d * st.r + st.r;
+        st.m = std::floor(st.fm);
+        st.p1 = std::floor(2.195 * stmath::sqrt(st.nrq) - 4.6 * st.q) + 0.5;
+        st.xm = st.m + 0.5;
+        st.xl = st.xm - st.p1;
+        st.xr = st.xm + st.p1;
+        st.c = 0.134 + 20.5 / (15.3 + st.m);
+
+        double a = (st.fm - st.xl) / (st.fm - st.xl * st.r);
+        st.laml = a * (1.0 + a / 2.0);
+
+        a = (st.xr - st.fm) / (st.xr * st.q);
+        st.lamr = a * (1.0 + a / 2.0);
+
+        st.p2 = st.p1 * (1.0 + 2.0 * st.c);
+        st.p3 = st.p2 + st.c / st.laml;
+        st.p4 = st.p3 + st.c / st.lamr;
+    }
+
+    return st;
+}
+
+statslib_inline
+double
+rbinom_inversion(const rbinom_setup_t& st, rand_engine_t& engine)
+{
+    double x = 0;
+    double px = st.qn;
+    double u = u64_to_unit_co(rand_u64(engine));
+
+    while (u > px) {
+        x += 1.0;
+
+        if (x > st.bound) {
+            x = 0;
+            px = st.qn;
+            u = u64_to_unit_co(rand_u64(engine));
+        } else {
+            u -= px;
+            px = ( (static_cast<double>(st.n_trials) - x + 1.0) * st.r * px ) / (x * st.q);
+        }
+    }
+
+    return x;
+}
+
+statslib_inline
+double
+rbinom_btpe_stirling(const double x, const double x_sq)
+{
+    return (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / x_sq) / x_sq) / x_sq) / x_sq) / x / 166320.0;
+}
+
+statslib_inline
+double
+rbinom_btpe(const rbinom_setup_t& st, rand_engine_t& engine)
+{
+    const double n_d = static_cast<double>(st.n_trials);
+
+    while (true) {
+        const double u = u64_to_unit_co(rand_u64(engine)) * st.p4;
+        double v = u64_to_unit_oo(rand_u64(engine));
+        double y = 0;
+
+        // triangular region: immediate acceptance
+
+        if (u <= st.p1) {
+            return std::floor(st.xm - st.p1 * v + u);
+        }
+
+        if (u <= st.p2) {
+            // parallelograms
+            const double x = st.xl + (u - st.p1) / st.c;
+            v = v * st.c + 1.0 - std::abs(st.m - x + 0.5) / st.p1;
+
+            if (v > 1.0) {
+                continue;
+            }
+
+            y = std::floor(x);
+        } else if (u <= st.p3) {
+            // left exponential tail
+            y = std::floor(st.xl + stmath::log(v) / st.laml);
+
+            if (y < 0.0) {
+                continue;
+            }
+
+            v = v * (u - st.p2) * st.laml;
+        } else {
+            // right exponential tail
+            y = std::floor(st.xr - stmath::log(v) / st.lamr);
+
+            if (y > n_d) {
+                continue;
+            }
+
+            v = v * (u - st.p3) * st.lamr;
+        }
+
+        const double k = std::abs(y - st.m);
+
+        if (k <= 20.0 || k >= st.nrq / 2.0 - 1.0) {
+            // explicit evaluation of f(y) / f(m)
+            const double s_val = st.r / st.q;
+            const double a_val = s_val * (n_d + 1.0);
+            double F = 1.0;
+
+            if (st.m < y) {
+                for (double i = st.m + 1.0; i <= y; i += 1.0) {
+                    F *= (a_val / i - s_val);
+                }
+            } else if (st.m > y) {
+                for (double i = y + 1.0; i <= st.m; i += 1.0) {
+                    F /= (a_val / i - s_val);
+                }
+            }
+
+            if (v <= F) {
+                return y;
+            }
+
+            continue;
+        }
+
+        // squeeze using upper and lower bounds on log(f(y))
+
+        const double rho = (k / st.nrq) * ((k * (k / 3.0 + 0.625) + 0.1666666666666) / st.nrq + 0.5);
+        const double t = - k * k / (2.0 * st.nrq);
+        const double A = stmath::log(v);
+
+        if (A < t - rho) {
+            return y;
+        }
+
+        if (A > t + rho) {
+            continue;
+        }
+
+        // final acceptance/rejection test with Stirling corrections
+
+        const double x1 = y + 1.0;
+        const double f1 = st.m + 1.0;
+        const double z = n_d + 1.0 - st.m;
+        const double w = n_d - y + 1.0;
+
+        const double bound_val = st.xm * stmath::log(f1 / x1) + (n_d - st.m + 0.5) * stmath::log(z / w) \
+                                 + (y - st.m) * stmath::log(w * st.r / (x1 * st.q)) \
+                                 + rbinom_btpe_stirling(f1, f1 * f1) + rbinom_btpe_stirling(z, z * z) \
+                                 + rbinom_btpe_stirling(x1, x1 * x1) + rbinom_btpe_stirling(w, w * w);
+
+        if (A <= bound_val) {
+            return y;
+        }
+    }
+}
+
+statslib_inline
+double
+rbinom_draw(const rbinom_setup_t& st, rand_engine_t& engine)
+{
+    if (st.n_trials == llint_t(0) || st.r == 0.0) {
+        return st.flip ? static_cast<double>(st.n_trials) : 0.0;
+    }
+
+    const double x = st.use_btpe ? rbinom_btpe(st,engine) : rbinom_inversion(st,engine);
+
+    return st.flip ? static_cast<double>(st.n_trials) - x : x;
+}
+
+}
+
 template<typename T>
 statslib_inline
 return_t<T>
 rbinom(const llint_t n_trials_par, const T prob_par, rand_engine_t& engine)
 {
     if (!internal::binom_sanity_check(n_trials_par,prob_par)) {
-        return STLIM<T>::quiet_NaN();
+        return STLIM<return_t<T>>::quiet_NaN();
     }
 
     //
 
-    return_t<T> ret = return_t<T>(0);
-
-    for (llint_t i=llint_t(0); i < n_trials_par; ++i)
-    {
-        ret += rbern(prob_par,engine);
-    }
+    const internal::rbinom_setup_t st = internal::rbinom_setup(n_trials_par,static_cast<double>(prob_par));
 
-    return ret;
+    return static_cast<return_t<T>>( internal::rbinom_draw(st,engine) );
 }
 
 template<typename T>
@@ -68,7 +283,16 @@ void
 rbinom_vec(const llint_t n_trials_par, const T1 prob_par, rand_engine_t& engine_0, 
            rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rbinom,vals_out,num_elem,engine_0,n_trials_par,prob_par);
+    if (!binom_sanity_check(n_trials_par,prob_par)) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    // setup is computed once and shared by all draws in the batch
+
+    const rbinom_setup_t st = rbinom_setup(n_trials_par,static_cast<double>(prob_par));
+
+    RAND_DIST_FN_VEC(rbinom_draw,vals_out,num_elem,engine_0,st);
 }
 #endif
 
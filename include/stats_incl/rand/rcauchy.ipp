@@ -28,15 +28,33 @@
 namespace internal
 {
 
+// quantile transform of a (0,1) draw; the parameters are checked by the caller
+
+template<typename T>
+statslib_inline
+T
+rcauchy_from_unit(const T unit_val, const T mu_par, const T sigma_par)
+{
+    return mu_par + sigma_par*std::tan(T(GCEM_PI)*(unit_val - T(0.5)));
+}
+
+template<typename T>
+statslib_inline
+bool
+rcauchy_par_check(const T mu_par, const T sigma_par)
+{
+    return cauchy_sanity_check(mu_par,sigma_par) && !GCINT::is_posinf(sigma_par);
+}
+
 template<typename T>
 statslib_inline
 T
 rcauchy_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
 {
-    return( !cauchy_sanity_check(mu_par,sigma_par) ? \
+    return( !rcauchy_par_check(mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qcauchy(runif(T(0),T(1),engine),mu_par,sigma_par) );
+            rcauchy_from_unit(u64_to_unit_oo<T>(rand_u64(engine)),mu_par,sigma_par) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -79,7 +97,16 @@ void
 rcauchy_vec(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine_0, 
             rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rcauchy,vals_out,num_elem,engine_0,mu_par,sigma_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!rcauchy_par_check(static_cast<TC>(mu_par),static_cast<TC>(sigma_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    RAND_UNIT_FN_VEC(TC,rcauchy_from_unit,vals_out,num_elem,engine_0,static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
 }
 #endif
 
@@ -122,4 +149,14 @@ rcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par,
     rand_engine_t engine(seed_val);
     GEN_MAT_RAND_FN(rcauchy_mat_check,mu_par,sigma_par,engine);
 }
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine, const rand_mode mode)
+{
+    typedef common_return_t<T1,T2> TC;
+
+    GEN_MAT_RAND_MODE_FN(TC,internal::rcauchy_par_check(static_cast<TC>(mu_par),static_cast<TC>(sigma_par)),rcauchy_from_unit,static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
+}
 #endif
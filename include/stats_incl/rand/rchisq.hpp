@@ -46,7 +46,7 @@
 template<typename T>
 statslib_inline
 return_t<T>
-rchisq(const T dof_par, rand_engine_t& engine);
+rchisq(const T dof_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Chi-squared distribution
@@ -65,7 +65,7 @@ rchisq(const T dof_par, rand_engine_t& engine);
 template<typename T>
 statslib_inline
 return_t<T>
-rchisq(const T dof_par, const ullint_t seed_val = std::random_device{}());
+rchisq(const T dof_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -101,7 +101,7 @@ rchisq(const T dof_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rchisq(const ullint_t n, const ullint_t k, const T1 dof_par, rand_engine_t& engine);
+rchisq(const ullint_t n, const ullint_t k, const T1 dof_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the Chi-squared distribution
@@ -131,7 +131,7 @@ rchisq(const ullint_t n, const ullint_t k, const T1 dof_par, rand_engine_t& engi
 template<typename mT, typename T1>
 statslib_inline
 mT
-rchisq(const ullint_t n, const ullint_t k, const T1 dof_par, const ullint_t seed_val = std::random_device{}());
+rchisq(const ullint_t n, const ullint_t k, const T1 dof_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
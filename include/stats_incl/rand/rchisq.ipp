@@ -28,6 +28,76 @@
 namespace internal
 {
 
+// for integer degrees of freedom up to this value, a draw is computed as
+// 2 * (sum of dof/2 exponentials) + (a squared normal if dof is odd)
+
+#ifndef STATS_RCHISQ_MAX_INT_DOF
+    #define STATS_RCHISQ_MAX_INT_DOF 4
+#endif
+
+template<typename T>
+struct rchisq_setup_t
+{
+    bool int_dof;
+    bool inf_dof;
+
+    int n_exp;
+    bool odd_dof;
+
+    rgamma_setup_t<T> gamma_st;
+};
+
+template<typename T>
+statslib_inline
+rchisq_setup_t<T>
+rchisq_setup(const T dof_par)
+{
+    rchisq_setup_t<T> st;
+
+    st.inf_dof = GCINT::is_posinf(dof_par);
+    st.int_dof = !st.inf_dof && dof_par <= T(STATS_RCHISQ_MAX_INT_DOF) && dof_par == std::floor(dof_par);
+
+    if (st.int_dof) {
+        const int dof_int = static_cast<int>(dof_par);
+
+        st.n_exp = dof_int / 2;
+        st.odd_dof = (dof_int % 2 == 1);
+    } else if (!st.inf_dof) {
+        st.gamma_st = rgamma_setup(dof_par/T(2),T(2));
+    }
+
+    return st;
+}
+
+template<typename T>
+statslib_inline
+T
+rchisq_draw(const rchisq_setup_t<T>& st, rand_engine_t& engine)
+{
+    if (st.int_dof) {
+        T ret = T(0);
+
+        for (int i = 0; i < st.n_exp; ++i) {
+            ret += zig_exp<T>(engine);
+        }
+
+        ret *= T(2);
+
+        if (st.odd_dof) {
+            const T Z = zig_norm<T>(engine);
+            ret += Z*Z;
+        }
+
+        return ret;
+    }
+
+    if (st.inf_dof) {
+        return STLIM<T>::infinity();
+    }
+
+    return rgamma_draw(st.gamma_st,engine);
+}
+
 template<typename T>
 statslib_inline
 T
@@ -36,7 +106,7 @@ rchisq_compute(const T dof_par, rand_engine_t& engine)
     return( !chisq_sanity_check(dof_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            rgamma(dof_par/T(2),T(2),engine) );
+            rchisq_draw(rchisq_setup(dof_par),engine) );
 }
 
 }
@@ -71,7 +141,20 @@ void
 rchisq_vec(const T1 dof_par, rand_engine_t& engine_0, 
            rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rchisq,vals_out,num_elem,engine_0,dof_par);
+    typedef return_t<T1> TC;
+
+    // parameters are checked once per batch
+
+    if (!chisq_sanity_check(static_cast<TC>(dof_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    // setup is computed once and shared by all draws in the batch
+
+    const rchisq_setup_t<TC> st = rchisq_setup(static_cast<TC>(dof_par));
+
+    RAND_DIST_FN_VEC(rchisq_draw,vals_out,num_elem,engine_0,st);
 }
 #endif
 
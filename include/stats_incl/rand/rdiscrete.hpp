@@ -0,0 +1,147 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sample from a discrete distribution using a prepared sampler
+ */
+
+#ifndef _statslib_rdiscrete_HPP
+#define _statslib_rdiscrete_HPP
+
+//
+// scalar output
+
+/**
+ * @brief Random sampling function for a discrete distribution with a prepared sampler
+ *
+ * @param sampler a prepared sampler, such as \c alias_table or \c guide_table.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw from the distribution described by \c sampler, or \c discrete_empty_val if the sampler is empty.
+ * 
+ * Example:
+ * \code{.cpp}
+ * stats::alias_table table(std::vector<double>{1.0, 2.0, 3.0});
+ * stats::rand_engine_t engine(1776);
+ * stats::rdiscrete(table,engine);
+ * \endcode
+ */
+
+template<typename sT>
+statslib_inline
+ullint_t
+rdiscrete(const sT& sampler, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
+
+/**
+ * @brief Random sampling function for a discrete distribution with a prepared sampler
+ *
+ * @param sampler a prepared sampler, such as \c alias_table or \c guide_table.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
+ *
+ * @return a pseudo-random draw from the distribution described by \c sampler, or \c discrete_empty_val if the sampler is empty.
+ * 
+ * Example:
+ * \code{.cpp}
+ * stats::alias_table table(std::vector<double>{1.0, 2.0, 3.0});
+ * stats::rdiscrete(table,1776);
+ * \endcode
+ */
+
+template<typename sT>
+statslib_inline
+ullint_t
+rdiscrete(const sT& sampler, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
+
+//
+// vector/matrix output
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+/**
+ * @brief Random matrix sampling function for a discrete distribution with a prepared sampler
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param sampler a prepared sampler, such as \c alias_table or \c guide_table.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the distribution described by \c sampler; filled with NaN if the sampler is empty.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::alias_table table(std::vector<double>{1.0, 2.0, 3.0});
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rdiscrete<std::vector<double>>(5,4,table,engine);
+ * // Armadillo matrix
+ * stats::rdiscrete<arma::mat>(5,4,table,engine);
+ * // Blaze dynamic matrix
+ * stats::rdiscrete<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,table,engine);
+ * // Eigen dynamic matrix
+ * stats::rdiscrete<Eigen::MatrixXd>(5,4,table,engine);
+ * \endcode
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+template<typename mT, typename sT>
+statslib_inline
+mT
+rdiscrete(const ullint_t n, const ullint_t k, const sT& sampler, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
+
+/**
+ * @brief Random matrix sampling function for a discrete distribution with a prepared sampler
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param sampler a prepared sampler, such as \c alias_table or \c guide_table.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
+ *
+ * @return a matrix of pseudo-random draws from the distribution described by \c sampler; filled with NaN if the sampler is empty.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::alias_table table(std::vector<double>{1.0, 2.0, 3.0});
+ * // std::vector
+ * stats::rdiscrete<std::vector<double>>(5,4,table);
+ * // Armadillo matrix
+ * stats::rdiscrete<arma::mat>(5,4,table);
+ * // Blaze dynamic matrix
+ * stats::rdiscrete<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,table);
+ * // Eigen dynamic matrix
+ * stats::rdiscrete<Eigen::MatrixXd>(5,4,table);
+ * \endcode
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+template<typename mT, typename sT>
+statslib_inline
+mT
+rdiscrete(const ullint_t n, const ullint_t k, const sT& sampler, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
+
+#endif
+
+//
+// include implementation files
+
+#include "rdiscrete.ipp"
+
+#endif
@@ -0,0 +1,119 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sample from a discrete distribution using a prepared sampler
+ */
+
+//
+// scalar output
+
+namespace internal
+{
+
+template<typename sT>
+statslib_inline
+ullint_t
+rdiscrete_draw(const sT& sampler, rand_engine_t& engine)
+{
+    return sampler(engine);
+}
+
+}
+
+template<typename sT>
+statslib_inline
+ullint_t
+rdiscrete(const sT& sampler, rand_engine_t& engine)
+{
+    return internal::rdiscrete_draw(sampler,engine);
+}
+
+template<typename sT>
+statslib_inline
+ullint_t
+rdiscrete(const sT& sampler, const ullint_t seed_val)
+{
+    rand_engine_t engine(seed_val);
+    return rdiscrete(sampler,engine);
+}
+
+//
+// vector/matrix output
+
+namespace internal
+{
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename sT, typename rT>
+statslib_inline
+void
+rdiscrete_vec(const sT& sampler, rand_engine_t& engine_0, 
+              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    if (sampler.size() == ullint_t(0)) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    RAND_DIST_FN_VEC(rdiscrete_draw,vals_out,num_elem,engine_0,sampler);
+}
+#endif
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename sT>
+statslib_inline
+void
+rdiscrete_mat_check(std::vector<eT>& X, const sT& sampler, rand_engine_t& engine_0)
+{
+    STDVEC_RAND_DIST_FN(rdiscrete,sampler,engine_0);
+}
+#endif
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+template<typename mT, typename sT>
+statslib_inline
+void
+rdiscrete_mat_check(mT& X, const sT& sampler, rand_engine_t& engine_0)
+{
+    MAIN_MAT_RAND_DIST_FN(rdiscrete,sampler,engine_0);
+}
+#endif
+
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename sT>
+statslib_inline
+mT
+rdiscrete(const ullint_t n, const ullint_t k, const sT& sampler, rand_engine_t& engine)
+{
+    GEN_MAT_RAND_FN(rdiscrete_mat_check,sampler,engine);
+}
+
+template<typename mT, typename sT>
+statslib_inline
+mT
+rdiscrete(const ullint_t n, const ullint_t k, const sT& sampler, const ullint_t seed_val)
+{
+    rand_engine_t engine(seed_val);
+    GEN_MAT_RAND_FN(rdiscrete_mat_check,sampler,engine);
+}
+#endif
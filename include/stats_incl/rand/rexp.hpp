@@ -46,7 +46,7 @@
 template<typename T>
 statslib_inline
 return_t<T>
-rexp(const T rate_par, rand_engine_t& engine);
+rexp(const T rate_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Exponential distribution
@@ -65,7 +65,7 @@ rexp(const T rate_par, rand_engine_t& engine);
 template<typename T>
 statslib_inline
 return_t<T>
-rexp(const T rate_par, const ullint_t seed_val = std::random_device{}());
+rexp(const T rate_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -101,7 +101,42 @@ rexp(const T rate_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rexp(const ullint_t n, const ullint_t k, const T1 rate_par, rand_engine_t& engine);
+rexp(const ullint_t n, const ullint_t k, const T1 rate_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
+
+/**
+ * @brief Random matrix sampling function for the Exponential distribution, with a variance-reduced sampling mode
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param rate_par the rate parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ * @param mode the sampling mode; see \c rand_mode.
+ *
+ * @return a matrix of pseudo-random draws from the Exponential distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rexp<std::vector<double>>(5,4,4,engine,stats::rand_mode::antithetic);
+ * // Armadillo matrix
+ * stats::rexp<arma::mat>(5,4,4,engine,stats::rand_mode::antithetic);
+ * // Blaze dynamic matrix
+ * stats::rexp<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,4,engine,stats::rand_mode::antithetic);
+ * // Eigen dynamic matrix
+ * stats::rexp<Eigen::MatrixXd>(5,4,4,engine,stats::rand_mode::antithetic);
+ * \endcode
+ *
+ * @note Draws are generated by inversion, column by column: with \c rand_mode::antithetic, row i + floor(n/2) is the antithetic partner of row i;
+ * with \c rand_mode::stratified, the rows form a Latin hypercube sample.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+template<typename mT, typename T1>
+statslib_inline
+mT
+rexp(const ullint_t n, const ullint_t k, const T1 rate_par, rand_engine_t& engine, const rand_mode mode);
 
 /**
  * @brief Random matrix sampling function for the Exponential distribution
@@ -131,7 +166,7 @@ rexp(const ullint_t n, const ullint_t k, const T1 rate_par, rand_engine_t& engin
 template<typename mT, typename T1>
 statslib_inline
 mT
-rexp(const ullint_t n, const ullint_t k, const T1 rate_par, const ullint_t seed_val = std::random_device{}());
+rexp(const ullint_t n, const ullint_t k, const T1 rate_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
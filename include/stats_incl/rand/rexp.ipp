@@ -36,7 +36,25 @@ rexp_compute(const T rate_par, rand_engine_t& engine)
     return( !exp_sanity_check(rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qexp(runif(T(0),T(1),engine),rate_par) );
+            zig_exp<T>(engine) / rate_par );
+}
+
+// quantile transform of a (0,1) draw, with U in place of 1 - U
+
+template<typename T>
+statslib_inline
+T
+rexp_from_unit(const T unit_val, const T rate_par)
+{
+    return - std::log(unit_val) / rate_par;
+}
+
+template<typename T>
+statslib_inline
+T
+rexp_vec_compute(const T rate_par, rand_engine_t& engine)
+{
+    return zig_exp<T>(engine) / rate_par;
 }
 
 }
@@ -71,7 +89,16 @@ void
 rexp_vec(const T1 rate_par, rand_engine_t& engine_0, 
          rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rexp,vals_out,num_elem,engine_0,rate_par);
+    typedef return_t<T1> TC;
+
+    // parameters are checked once per batch
+
+    if (!exp_sanity_check(static_cast<TC>(rate_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    RAND_DIST_FN_VEC(rexp_vec_compute,vals_out,num_elem,engine_0,static_cast<TC>(rate_par));
 }
 #endif
 
@@ -114,4 +141,14 @@ rexp(const ullint_t n, const ullint_t k, const T1 rate_par, const ullint_t seed_
     rand_engine_t engine(seed_val);
     GEN_MAT_RAND_FN(rexp_mat_check,rate_par,engine);
 }
+
+template<typename mT, typename T1>
+statslib_inline
+mT
+rexp(const ullint_t n, const ullint_t k, const T1 rate_par, rand_engine_t& engine, const rand_mode mode)
+{
+    typedef return_t<T1> TC;
+
+    GEN_MAT_RAND_MODE_FN(TC,internal::exp_sanity_check(static_cast<TC>(rate_par)),rexp_from_unit,static_cast<TC>(rate_par));
+}
 #endif
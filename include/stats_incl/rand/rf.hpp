@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rf(const T1 df1_par, const T2 df2_par, rand_engine_t& engine);
+rf(const T1 df1_par, const T2 df2_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the F-distribution
@@ -67,7 +67,7 @@ rf(const T1 df1_par, const T2 df2_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rf(const T1 df1_par, const T2 df2_par, const ullint_t seed_val = std::random_device{}());
+rf(const T1 df1_par, const T2 df2_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,7 @@ rf(const T1 df1_par, const T2 df2_par, const ullint_t seed_val = std::random_dev
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par, rand_engine_t& engine);
+rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the F-distribution
@@ -135,7 +135,7 @@ rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par, rand_
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par, const ullint_t seed_val = std::random_device{}());
+rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
@@ -28,6 +28,53 @@
 namespace internal
 {
 
+template<typename T>
+struct rf_setup_t
+{
+    T df1;
+    T df2;
+
+    rchisq_setup_t<T> chisq_st_1;
+    rchisq_setup_t<T> chisq_st_2;
+};
+
+template<typename T>
+statslib_inline
+rf_setup_t<T>
+rf_setup(const T df1_par, const T df2_par)
+{
+    rf_setup_t<T> st;
+
+    st.df1 = df1_par;
+    st.df2 = df2_par;
+
+    st.chisq_st_1 = rchisq_setup(df1_par);
+    st.chisq_st_2 = rchisq_setup(df2_par);
+
+    return st;
+}
+
+// X / dof for X ~ chi-squared(dof); equal to 1 in the limit dof -> infinity
+
+template<typename T>
+statslib_inline
+T
+rf_scaled_chisq_draw(const rchisq_setup_t<T>& chisq_st, const T dof_par, rand_engine_t& engine)
+{
+    return( chisq_st.inf_dof ? T(1) : rchisq_draw(chisq_st,engine) / dof_par );
+}
+
+template<typename T>
+statslib_inline
+T
+rf_draw(const rf_setup_t<T>& st, rand_engine_t& engine)
+{
+    const T X = rf_scaled_chisq_draw(st.chisq_st_1,st.df1,engine);
+    const T Y = rf_scaled_chisq_draw(st.chisq_st_2,st.df2,engine);
+
+    return X / Y;
+}
+
 template<typename T>
 statslib_inline
 T
@@ -38,11 +85,8 @@ rf_compute(const T df1_par, const T df2_par, rand_engine_t& engine)
     }
 
     //
-    
-    const T X = rchisq(df1_par,engine);
-    const T Y = rchisq(df2_par,engine);
-    
-    return( (df2_par / df1_par) * X / Y );
+
+    return rf_draw(rf_setup(df1_par,df2_par),engine);
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -85,7 +129,20 @@ void
 rf_vec(const T1 df1_par, const T2 df2_par, rand_engine_t& engine_0, 
        rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rf,vals_out,num_elem,engine_0,df1_par,df2_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!f_sanity_check(static_cast<TC>(df1_par),static_cast<TC>(df2_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    // setup is computed once and shared by all draws in the batch
+
+    const rf_setup_t<TC> st = rf_setup(static_cast<TC>(df1_par),static_cast<TC>(df2_par));
+
+    RAND_DIST_FN_VEC(rf_draw,vals_out,num_elem,engine_0,st);
 }
 #endif
 
@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rgamma(const T1 shape_par, const T2 scale_par, rand_engine_t& engine);
+rgamma(const T1 shape_par, const T2 scale_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Gamma distribution
@@ -67,7 +67,7 @@ rgamma(const T1 shape_par, const T2 scale_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rgamma(const T1 shape_par, const T2 scale_par, const ullint_t seed_val = std::random_device{}());
+rgamma(const T1 shape_par, const T2 scale_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,7 @@ rgamma(const T1 shape_par, const T2 scale_par, const ullint_t seed_val = std::ra
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, rand_engine_t& engine);
+rgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the Gamma distribution
@@ -135,7 +135,7 @@ rgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_pa
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, const ullint_t seed_val = std::random_device{}());
+rgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
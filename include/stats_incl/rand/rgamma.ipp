@@ -29,50 +29,82 @@
 namespace internal
 {
 
+// constants that depend only on (shape, scale); computed once per parameter pair.
+// For shape < 1, draws are taken with shape + 1 and multiplied by U^(1/shape).
+
+template<typename T>
+struct rgamma_setup_t
+{
+    T shape;
+    T scale;
+    bool boost;
+
+    T d;
+    T c;
+};
+
 template<typename T>
 statslib_inline
-T
-rgamma_compute(const T shape_par, const T scale_par, rand_engine_t& engine)
+rgamma_setup_t<T>
+rgamma_setup(const T shape_par, const T scale_par)
 {
-    if (!gamma_sanity_check(shape_par,scale_par)) {
-        return STLIM<T>::quiet_NaN();
-    }
+    rgamma_setup_t<T> st;
 
-    //
+    st.shape = shape_par;
+    st.scale = scale_par;
+    st.boost = !(shape_par > T(1));
 
-    T ret = 0;
+    st.d = (st.boost ? shape_par + T(1) : shape_par) - T(1)/T(3);
+    st.c = (T(1)/T(3)) / std::sqrt(st.d);
 
-    if (shape_par > T(1)) {
-        const T d = shape_par - T(1)/T(3);
-        const T c = (T(1)/T(3)) / std::sqrt(d);
-        T V = 1;
+    return st;
+}
 
-        bool keep_running = true;
+template<typename T>
+statslib_inline
+T
+rgamma_draw(const rgamma_setup_t<T>& st, rand_engine_t& engine)
+{
+    T V = 1;
 
-        while (keep_running) {
-            T Z = rnorm(T(0),T(1),engine);
+    while (true) {
+        const T Z = zig_norm<T>(engine);
 
-            if (Z > -T(1)/c) {
-                V = std::pow(T(1) + c*Z, 3);
-                T U = runif(T(0),T(1),engine);
+        if (Z > -T(1)/st.c) {
+            V = T(1) + st.c*Z;
+            V = V*V*V;
 
-                T check_2 = T(0.5)*Z*Z + d*(T(1) - V + std::log(V));
+            // log(U) for U ~ U(0,1) is the negative of a standard exponential draw
+            const T log_U = - zig_exp<T>(engine);
 
-                if (std::log(U) < check_2) {
-                    keep_running = false;
-                }
+            if (log_U < T(0.5)*Z*Z + st.d*(T(1) - V + std::log(V))) {
+                break;
             }
         }
+    }
 
-        ret = d * V * scale_par;
-    } else {
-        const T U = runif(T(0),T(1),engine);
-        ret = rgamma(T(1) + shape_par, scale_par,engine) * std::pow(U, T(1)/shape_par);
+    T ret = st.d * V * st.scale;
+
+    if (st.boost) {
+        // U^(1/a) = exp(-E/a) with E a standard exponential draw
+        ret *= std::exp(- zig_exp<T>(engine) / st.shape);
+    }
+
+    return ret;
+}
+
+template<typename T>
+statslib_inline
+T
+rgamma_compute(const T shape_par, const T scale_par, rand_engine_t& engine)
+{
+    if (!gamma_sanity_check(shape_par,scale_par)) {
+        return STLIM<T>::quiet_NaN();
     }
 
     //
 
-    return ret;
+    return rgamma_draw(rgamma_setup(shape_par,scale_par),engine);
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -116,7 +148,20 @@ void
 rgamma_vec(const T1 shape_par, const T2 scale_par, rand_engine_t& engine_0, 
            rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rgamma,vals_out,num_elem,engine_0,shape_par,scale_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!gamma_sanity_check(static_cast<TC>(shape_par),static_cast<TC>(scale_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    // setup is computed once and shared by all draws in the batch
+
+    const rgamma_setup_t<TC> st = rgamma_setup(static_cast<TC>(shape_par),static_cast<TC>(scale_par));
+
+    RAND_DIST_FN_VEC(rgamma_draw,vals_out,num_elem,engine_0,st);
 }
 #endif
 
@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rinvgamma(const T1 shape_par, const T2 rate_par, rand_engine_t& engine);
+rinvgamma(const T1 shape_par, const T2 rate_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Inverse-Gamma distribution
@@ -67,7 +67,7 @@ rinvgamma(const T1 shape_par, const T2 rate_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rinvgamma(const T1 shape_par, const T2 rate_par, const ullint_t seed_val = std::random_device{}());
+rinvgamma(const T1 shape_par, const T2 rate_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,7 @@ rinvgamma(const T1 shape_par, const T2 rate_par, const ullint_t seed_val = std::
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par, rand_engine_t& engine);
+rinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the Inverse-Gamma distribution
@@ -135,7 +135,7 @@ rinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par, const ullint_t seed_val = std::random_device{}());
+rinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rinvgauss(const T1 mu_par, const T2 lambda_par, rand_engine_t& engine);
+rinvgauss(const T1 mu_par, const T2 lambda_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * Random sampling function for the inverse Gaussian distribution
@@ -67,7 +67,7 @@ rinvgauss(const T1 mu_par, const T2 lambda_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rinvgauss(const T1 mu_par, const T2 lambda_par, const ullint_t seed_val = std::random_device{}());
+rinvgauss(const T1 mu_par, const T2 lambda_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,7 @@ rinvgauss(const T1 mu_par, const T2 lambda_par, const ullint_t seed_val = std::r
 template<typename mT, typename T1 = double, typename T2 = double>
 statslib_inline
 mT
-rinvgauss(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 lambda_par, rand_engine_t& engine);
+rinvgauss(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 lambda_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the inverse Gaussian distribution
@@ -135,7 +135,7 @@ rinvgauss(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 lambda_p
 template<typename mT, typename T1 = double, typename T2 = double>
 statslib_inline
 mT
-rinvgauss(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 lambda_par, const ullint_t seed_val = std::random_device{}());
+rinvgauss(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 lambda_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
@@ -28,30 +28,41 @@
 namespace internal
 {
 
+// Michael, Schucany, and Haas (1976). With w = mu Z^2 / (2 lambda), the smaller root of the transformation is
+// x = mu / r, where r = 1 + w + sqrt(w (w + 2)) (written without cancellation); x is accepted with
+// probability mu / (mu + x) = r / (r + 1), and otherwise the larger root mu^2 / x = mu r is returned.
+
 template<typename T>
 statslib_inline
 T
-rinvgauss_compute(const T mu_par, const T lambda_par, rand_engine_t& engine)
+rinvgauss_root_select(const T mu_par, const T w_scale, const T norm_val, const T unif_val)
 {
-    T mu_sq = mu_par * mu_par;
+    const T w = w_scale * norm_val * norm_val;
+    const T r = T(1) + w + std::sqrt(w * (w + T(2)));
 
-    T nu = rnorm(T(0), T(1), engine);
+    // select the root arithmetically: a comparison (even as a ternary select) stops GCC vectorizing
+    // the loop under the default -ftrapping-math; copysign does not
 
-    T y = nu * nu;
+    const T half_sign = std::copysign(T(0.5), r - unif_val * (r + T(1))); // +1/2 if accepted, else -1/2
 
-    T x = mu_par + ( mu_sq * y - mu_par * stmath::sqrt(T(4) * mu_par * lambda_par * y + mu_sq * y * y) ) / (T(2) * lambda_par);
+    return mu_par * ( (T(0.5) + half_sign) / r + (T(0.5) - half_sign) * r );
+}
 
-    //
+template<typename T>
+statslib_inline
+T
+rinvgauss_compute(const T mu_par, const T lambda_par, rand_engine_t& engine)
+{
+    if (!invgauss_sanity_check(mu_par,lambda_par)) {
+        return STLIM<T>::quiet_NaN();
+    }
 
-    T z = runif(T(0), T(1), engine);
+    //
 
-    T check_val = mu_par / ( mu_par + x );
+    const T norm_val = zig_norm<T>(engine);
+    const T unif_val = u64_to_unit_oo<T>(rand_u64(engine));
 
-    if (z <= check_val) {
-        return x;
-    } else {
-        return mu_sq / x;
-    }
+    return rinvgauss_root_select(mu_par, mu_par / (T(2)*lambda_par), norm_val, unif_val);
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -93,7 +104,37 @@ void
 rinvgauss_vec(const T1 mu_par, const T2 lambda_par, rand_engine_t& engine_0, 
               rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rinvgauss,vals_out,num_elem,engine_0,mu_par,lambda_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!invgauss_sanity_check(static_cast<TC>(mu_par),static_cast<TC>(lambda_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    const TC mu_val = static_cast<TC>(mu_par);
+    const TC w_scale = mu_val / (TC(2)*static_cast<TC>(lambda_par));
+
+    // normals and uniforms are drawn into buffers, then transformed in one branch-free pass
+
+    rand_fill_block_vec(vals_out, num_elem, engine_0,
+        [mu_val,w_scale](rT* __stats_pointer_settings__ block_out, const ullint_t n_vals, rand_engine_t& engine)
+        {
+            TC norm_vals[STATS_RAND_UNIT_BLOCK_SIZE];
+            TC unif_vals[STATS_RAND_UNIT_BLOCK_SIZE];
+
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                norm_vals[j] = zig_norm<TC>(engine);
+            }
+
+            fill_unit_oo(engine,unif_vals,n_vals);
+
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                block_out[j] = rinvgauss_root_select(mu_val,w_scale,norm_vals[j],unif_vals[j]);
+            }
+        },
+        STATS_OMP_COST_rinvgauss);
 }
 #endif
 
@@ -22,43 +22,78 @@
  * Sample from an inverse-Wishart distribution
  */
 
-template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
+namespace internal
+{
+
+// lower Cholesky factor of Psi from a lower factor C of Psi^{-1}: Psi = C^{-T} C^{-1}, with C^{-1} found by
+// forward substitution
+
+template<typename mT>
 statslib_inline
 mT
-rinvwish(const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_inv_chol)
+rinvwish_chol_from_inv_chol(const mT& chol_Psi_inv)
 {
-    typedef return_t<pT> eT;
-    const ullint_t K = mat_ops::n_rows(Psi_par);
-    
-    mT chol_Psi_inv;
-    if (pre_inv_chol) {
-        chol_Psi_inv = Psi_par; // should be lower triangular
-    } else {
-        chol_Psi_inv = mat_ops::chol(mat_ops::inv(Psi_par)); // will be lower triangular
+    typedef typename std::decay<decltype(chol_Psi_inv(0,0))>::type eT;
+
+    const ullint_t K = mat_ops::n_rows(chol_Psi_inv);
+
+    std::vector<eT> C_inv(K*K, eT(0));
+
+    for (ullint_t j = 0U; j < K; ++j)
+    {
+        C_inv[j + j*K] = eT(1) / chol_Psi_inv(j,j);
+
+        for (ullint_t i = j + 1U; i < K; ++i)
+        {
+            eT c_ij = eT(0);
+
+            for (ullint_t l = j; l < i; ++l) {
+                c_ij -= chol_Psi_inv(i,l) * C_inv[l + j*K];
+            }
+
+            C_inv[i + j*K] = c_ij / chol_Psi_inv(i,i);
+        }
     }
 
-    //
+    mT Psi;
+    mat_ops::resize(Psi,K,K);
+
+    for (ullint_t j = 0U; j < K; ++j) {
+        for (ullint_t i = j; i < K; ++i)
+        {
+            eT psi_ij = eT(0);
 
-    mT A;
-    mat_ops::zeros(A,K,K);
+            for (ullint_t l = i; l < K; ++l) {
+                psi_ij += C_inv[l + i*K] * C_inv[l + j*K];
+            }
 
-    for (ullint_t i=1U; i < K; i++) {
-        for (ullint_t j=0U; j < i; j++) {
-            A(i,j) = rnorm<eT>(eT(0),eT(1),engine);
+            Psi(i,j) = psi_ij;
+            Psi(j,i) = psi_ij;
         }
     }
+
+    return mat_ops::chol(Psi);
+}
+
+}
+
+template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
+statslib_inline
+mT
+rinvwish(const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_inv_chol)
+{
+    typedef return_t<pT> eT;
     
-    for (ullint_t i=0U; i < K; i++) {
-        A(i,i) = std::sqrt(rchisq<eT>(eT(nu_par-i),engine));
+    mT chol_Psi;
+    if (pre_inv_chol) {
+        chol_Psi = internal::rinvwish_chol_from_inv_chol(Psi_par);
+    } else {
+        chol_Psi = mat_ops::chol(Psi_par); // will be lower triangular
     }
 
-    chol_Psi_inv = chol_Psi_inv*A;
-
     //
-
-    mT mat_out_inv = chol_Psi_inv * mat_ops::trans(chol_Psi_inv); // avoid Glue issues
     
-    return mat_ops::inv( mat_out_inv );
+    return internal::rwish_single<mT>(internal::rwish_setup(chol_Psi,static_cast<eT>(nu_par),true),engine);
 }
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
@@ -67,28 +102,27 @@ statslib_inline
 mT
 rinvwish(const ArmaMat<eT>& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_inv_chol)
 {
-    const ullint_t K = Psi_par.n_rows;
-    
-    ArmaMat<eT> chol_Psi = (pre_inv_chol) ? Psi_par : arma::chol(arma::inv(Psi_par),"lower"); // should be lower-triangular
+    const ArmaMat<eT> chol_Psi = (pre_inv_chol) ? internal::rinvwish_chol_from_inv_chol(Psi_par) : mat_ops::chol(Psi_par);
 
     //
+    
+    return internal::rwish_single<mT>(internal::rwish_setup(chol_Psi,static_cast<eT>(nu_par),true),engine);
+}
+#endif
 
-    ArmaMat<eT> A = arma::zeros(K,K);
+//
+// n-samples: results will be a contiguous n*K*K buffer
 
-    for (ullint_t i=1U; i < K; i++) {
-        for (ullint_t j=0U; j < i; j++) {
-            A(i,j) = rnorm<eT>(eT(0),eT(1),engine);
-        }
-    }
-    
-    for (ullint_t i=0U; i < K; i++) {
-        A(i,i) = std::sqrt(rchisq<eT>(eT(nu_par-i),engine));
-    }
+template<typename mT, typename pT>
+statslib_inline
+std::vector<return_t<pT>>
+rinvwish(const ullint_t n, const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_inv_chol)
+{
+    typedef return_t<pT> eT;
 
-    chol_Psi = chol_Psi*A;
+    const mT chol_Psi = (pre_inv_chol) ? internal::rinvwish_chol_from_inv_chol(Psi_par) : mat_ops::chol(Psi_par);
 
-    //
-    
-    return arma::inv(chol_Psi * chol_Psi.t());
+    // setup is computed once and shared by all draws in the batch
+
+    return internal::rwish_batch(n,internal::rwish_setup(chol_Psi,static_cast<eT>(nu_par),true),engine);
 }
-#endif
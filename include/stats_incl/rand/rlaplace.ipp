@@ -28,6 +28,17 @@
 namespace internal
 {
 
+// quantile transform of a (0,1) draw: the tail mass min(U, 1 - U) is taken before the log, so that
+// neither tail loses precision, and the sign of U - 1/2 is applied without a branch
+
+template<typename T>
+statslib_inline
+T
+rlaplace_from_unit(const T unit_val, const T mu_par, const T sigma_par)
+{
+    return mu_par + sigma_par*std::copysign(- std::log(T(2)*std::min(unit_val, T(1) - unit_val)), unit_val - T(0.5));
+}
+
 template<typename T>
 statslib_inline
 T
@@ -36,7 +47,7 @@ rlaplace_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
     return( !laplace_sanity_check(mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qlaplace(runif(T(0),T(1),engine),mu_par,sigma_par) );
+            rlaplace_from_unit(u64_to_unit_oo<T>(rand_u64(engine)),mu_par,sigma_par) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -79,7 +90,16 @@ void
 rlaplace_vec(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine_0, 
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rlaplace,vals_out,num_elem,engine_0,mu_par,sigma_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!laplace_sanity_check(static_cast<TC>(mu_par),static_cast<TC>(sigma_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    RAND_UNIT_FN_VEC(TC,rlaplace_from_unit,vals_out,num_elem,engine_0,static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
 }
 #endif
 
@@ -122,4 +142,14 @@ rlaplace(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par
     rand_engine_t engine(seed_val);
     GEN_MAT_RAND_FN(rlaplace_mat_check,mu_par,sigma_par,engine);
 }
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rlaplace(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine, const rand_mode mode)
+{
+    typedef common_return_t<T1,T2> TC;
+
+    GEN_MAT_RAND_MODE_FN(TC,internal::laplace_sanity_check(static_cast<TC>(mu_par),static_cast<TC>(sigma_par)),rlaplace_from_unit,static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
+}
 #endif
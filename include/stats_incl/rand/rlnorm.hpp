@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rlnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rlnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * Random sampling function for the Log-Normal distribution
@@ -67,7 +67,7 @@ rlnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rlnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rlnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,7 @@ rlnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::rando
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the Log-Normal distribution
@@ -135,7 +135,7 @@ rlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par,
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rlogis(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rlogis(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * Random sampling function for the Logistic distribution
@@ -67,7 +67,7 @@ rlogis(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rlogis(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rlogis(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,43 @@ rlogis(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::rando
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
+
+/**
+ * @brief Random matrix sampling function for the Logistic distribution, with a variance-reduced sampling mode
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ * @param mode the sampling mode; see \c rand_mode.
+ *
+ * @return a matrix of pseudo-random draws from the Logistic distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rlogis<std::vector<double>>(5,4,1.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Armadillo matrix
+ * stats::rlogis<arma::mat>(5,4,1.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Blaze dynamic matrix
+ * stats::rlogis<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,1.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Eigen dynamic matrix
+ * stats::rlogis<Eigen::MatrixXd>(5,4,1.0,2.0,engine,stats::rand_mode::antithetic);
+ * \endcode
+ *
+ * @note Draws are generated by inversion, column by column: with \c rand_mode::antithetic, row i + floor(n/2) is the antithetic partner of row i;
+ * with \c rand_mode::stratified, the rows form a Latin hypercube sample.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine, const rand_mode mode);
 
 /**
  * @brief Random matrix sampling function for the Logistic distribution
@@ -135,7 +171,7 @@ rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par,
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
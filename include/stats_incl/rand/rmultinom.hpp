@@ -30,10 +30,40 @@
 /**
  * @brief Random sampling function for the Multinomial distribution
  *
- * @param prob_vec a vector of probability parameters.
+ * @param n_trials the number of trials.
+ * @param prob_vec a column vector of (non-negative) category weights; normalized internally.
  * @param engine a random engine, passed by reference.
  *
- * @return a pseudo-random draw from the Multinomial distribution.
+ * @return a pseudo-random draw from the Multinomial distribution: a column vector of category counts that sum to \c n_trials.
+ */
+
+template<typename mT, typename eT = double>
+statslib_inline
+mT rmultinom(const llint_t n_trials, const mT& prob_vec, rand_engine_t& engine);
+
+/**
+ * @brief Random sampling function for the Multinomial distribution
+ *
+ * @param n number of (independent) samples to draw.
+ * @param n_trials the number of trials.
+ * @param prob_vec a column vector of (non-negative) category weights; normalized internally.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return an \c n by \c K matrix of category counts, one draw per row, where \c K is the number of categories.
+ */
+
+// n samples
+template<typename mT, typename eT = double>
+statslib_inline
+mT rmultinom(const ullint_t n, const llint_t n_trials, const mT& prob_vec, rand_engine_t& engine);
+
+/**
+ * @brief Random sampling function for the Multinomial distribution
+ *
+ * @param prob_vec a column vector of probability parameters.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw from the Multinomial distribution, with the number of trials equal to the number of categories.
  */
 
 template<typename mT, typename eT = double>
@@ -22,40 +22,169 @@
  * Sample from a multinomial distribution
  */
 
+namespace internal
+{
+
+// returns the total weight, or NaN if the weights or trial count are invalid
+
 template<typename mT, typename eT>
 statslib_inline
-mT
-rmultinom(const mT& prob_vec, rand_engine_t& engine)
+eT
+rmultinom_prob_sum(const llint_t n_trials, const mT& prob_vec)
 {
     const ullint_t n_prob = mat_ops::n_elem(prob_vec);
 
-    ullint_t n_j = n_prob;
+    eT prob_sum = eT(0);
 
-    //
+    for (ullint_t j = 0U; j < n_prob; ++j)
+    {
+        const eT p_j = prob_vec(j,0);
+
+        if (!(p_j >= eT(0)) || !GCINT::is_finite(p_j)) {
+            return STLIM<eT>::quiet_NaN();
+        }
+
+        prob_sum += p_j;
+    }
+
+    if (n_trials < llint_t(0) || !(prob_sum > eT(0)) || !GCINT::is_finite(prob_sum)) {
+        return STLIM<eT>::quiet_NaN();
+    }
+
+    return prob_sum;
+}
+
+// conditional binomial method: N_j ~ Bin(n - N_1 - ... - N_{j-1}, p_j / (p_j + ... + p_K)).
+// store_fn(j, count) receives each count; categories after the trials run out are zero.
+//
+// The last category of positive weight takes the remaining trials: prob_left is updated by subtraction, so
+// p_j / prob_left can fall just short of one there, which would leave trials for zero-weight categories after it.
+
+template<typename mT, typename eT, typename fT>
+statslib_inline
+void
+rmultinom_draw(const llint_t n_trials, const mT& prob_vec, const eT prob_sum, rand_engine_t& engine, fT store_fn)
+{
+    const ullint_t n_prob = mat_ops::n_elem(prob_vec);
+
+    llint_t n_left = n_trials;
+    eT prob_left = prob_sum;
+
+    // one past the last category of positive weight; prob_sum > 0, so there is one
+
+    ullint_t j_end = n_prob;
+
+    while (j_end > 1U && !(prob_vec(j_end-1,0) > eT(0))) {
+        --j_end;
+    }
+
+    ullint_t j = 0U;
+
+    for (; j + 1U < j_end && n_left > llint_t(0); ++j)
+    {
+        const eT p_j = prob_vec(j,0);
+
+        llint_t count_j = 0;
+
+        if (p_j > eT(0)) {
+            const double p_cond = std::min(1.0, static_cast<double>(p_j / prob_left));
+
+            count_j = static_cast<llint_t>( rbinom_draw(rbinom_setup(n_left,p_cond),engine) );
+        }
+
+        store_fn(j,static_cast<eT>(count_j));
+
+        n_left -= count_j;
+        prob_left -= p_j;
+    }
+
+    // the last category of positive weight takes the remaining trials
+
+    if (j < j_end) {
+        store_fn(j,static_cast<eT>(n_left));
+        ++j;
+    }
+
+    for (; j < n_prob; ++j)
+    {
+        store_fn(j,eT(0));
+    }
+}
+
+}
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+rmultinom(const llint_t n_trials, const mT& prob_vec, rand_engine_t& engine)
+{
+    const ullint_t n_prob = mat_ops::n_elem(prob_vec);
 
     mT ret(n_prob,1);
-    const mT prob_vec_csum = mat_ops::cumsum(prob_vec);
 
-    eT p_j = prob_vec(0,0);
-    ret(0,0) = rbinom(n_j,p_j);
+    const eT prob_sum = internal::rmultinom_prob_sum<mT,eT>(n_trials,prob_vec);
+
+    if (GCINT::is_nan(prob_sum)) {
+        for (ullint_t j = 0U; j < n_prob; ++j) {
+            ret(j,0) = STLIM<eT>::quiet_NaN();
+        }
+
+        return ret;
+    }
 
     //
 
-    if (n_prob > 1U) {
-        ullint_t ret_sum = ret(0,0);
-        
-        for (ullint_t j = 1U; j < n_prob; j++)
-        {
-            p_j = prob_vec(j,0) / (eT(1) - prob_vec_csum(j-1,0));
-            n_j = n_prob - ret_sum;
-            
-            ret(j,0) = rbinom(n_j, p_j, engine);
-            
-            ret_sum += ret(j,0);
+    internal::rmultinom_draw(n_trials,prob_vec,prob_sum,engine,
+                             [&ret](const ullint_t j, const eT count_j){ ret(j,0) = count_j; });
+
+    return ret;
+}
+
+//
+// n-samples: results will be an n x K matrix
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+rmultinom(const ullint_t n, const llint_t n_trials, const mT& prob_vec, rand_engine_t& engine)
+{
+    const ullint_t n_prob = mat_ops::n_elem(prob_vec);
+
+    mT ret(n,n_prob);
+
+    // weights are checked and summed once per batch
+
+    const eT prob_sum = internal::rmultinom_prob_sum<mT,eT>(n_trials,prob_vec);
+
+    if (GCINT::is_nan(prob_sum)) {
+        for (ullint_t i = 0U; i < n; ++i) {
+            for (ullint_t j = 0U; j < n_prob; ++j) {
+                ret(i,j) = STLIM<eT>::quiet_NaN();
+            }
         }
+
+        return ret;
     }
 
-    //
+    // per draw: one conditional binomial draw per category
+
+    internal::rand_run_vec(n,engine,
+        [&](const ullint_t i, rand_engine_t& engine_i)
+        {
+            internal::rmultinom_draw(n_trials,prob_vec,prob_sum,engine_i,
+                                     [&ret,i](const ullint_t j, const eT count_j){ ret(i,j) = count_j; });
+        },
+        n_prob*STATS_OMP_COST_rbinom_draw);
 
     return ret;
 }
+
+// legacy form: the number of trials equals the number of categories
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+rmultinom(const mT& prob_vec, rand_engine_t& engine)
+{
+    return rmultinom<mT,eT>(static_cast<llint_t>(mat_ops::n_elem(prob_vec)),prob_vec,engine);
+}
@@ -60,6 +60,32 @@ template<typename vT, typename mT, typename not_arma_mat<mT>::type* = nullptr>
 statslib_inline
 mT rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, rand_engine_t& engine, const bool pre_chol = false);
 
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Multivariate-Normal distribution
+ *
+ * @param n number of points to draw
+ * @param mu_par mean vector.
+ * @param Sigma_par the covariance matrix.
+ * @param seq a low-discrepancy sequence, \c sobol_seq or \c halton_seq, of dimension K, passed by reference; it is advanced by \c n points.
+ * @param pre_chol indicate whether \c Sigma_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return an n x K matrix whose i-th row is mu + A z_i, where A is the lower Cholesky factor of \c Sigma_par and 
+ * z_i holds the standard normal quantiles of the coordinates of the i-th point of \c seq.
+ *
+ * Example:
+ * \code{.cpp}
+ * Eigen::VectorXd mu = Eigen::VectorXd::Zero(3);
+ * Eigen::MatrixXd Sigma = Eigen::MatrixXd::Identity(3,3);
+ * stats::sobol_seq seq(3, true, 1776);
+ * stats::rmvnorm(1024,mu,Sigma,seq);
+ * \endcode
+ */
+
+// n quasi-random points
+template<typename vT, typename mT, typename sT, typename std::enable_if<internal::is_qmc_seq<sT>::value>::type* = nullptr>
+statslib_inline
+mT rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, sT& seq, const bool pre_chol = false);
+
 //
 // specializations
 
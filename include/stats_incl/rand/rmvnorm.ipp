@@ -81,6 +81,129 @@ rmvnorm(const mT& mu_par, const ArmaMat<eT>& Sigma_par, rand_engine_t& engine, c
 //
 // n-samples: results will be an n x K matrix
 
+namespace internal
+{
+
+// the transform x = mu + A z, where A is lower-triangular: only the lower triangle of A is kept, packed by row,
+// together with the mean vector; both are read by all threads
+
+template<typename eT>
+struct rmvnorm_chol_t
+{
+    ullint_t K;
+    std::vector<eT> A_lower;
+    std::vector<eT> mu_vals;
+};
+
+template<typename eT, typename vT, typename cT>
+statslib_inline
+rmvnorm_chol_t<eT>
+rmvnorm_chol_setup(const vT& mu_par, const cT& A)
+{
+    rmvnorm_chol_t<eT> st;
+
+    st.K = mat_ops::n_rows(A);
+    st.A_lower.resize(st.K*(st.K+1)/2);
+    st.mu_vals.resize(st.K);
+
+    const bool mu_is_col = (mat_ops::n_rows(mu_par) == st.K);
+
+    for (ullint_t j = 0U; j < st.K; ++j)
+    {
+        for (ullint_t l = 0U; l <= j; ++l) {
+            st.A_lower[j*(j+1)/2 + l] = A(j,l);
+        }
+
+        st.mu_vals[j] = mu_is_col ? mu_par(j,0) : mu_par(0,j);
+    }
+
+    return st;
+}
+
+// write mu' + (A z)' to row i of X
+
+template<typename eT, typename mT>
+statslib_inline
+void
+rmvnorm_chol_row(const rmvnorm_chol_t<eT>& st, const eT* z, mT& X, const ullint_t i)
+{
+    const eT* A_row = st.A_lower.data();
+
+    for (ullint_t j = 0U; j < st.K; ++j)
+    {
+        eT x_j = st.mu_vals[j];
+
+        for (ullint_t l = 0U; l <= j; ++l) {
+            x_j += A_row[l] * z[l];
+        }
+
+        X(i,j) = x_j;
+        A_row += j + 1;
+    }
+}
+
+// fill the rows of X with mu' + (A z_i)', where z_i is a vector of standard normals; z_i is drawn into a
+// K-length scratch vector, allocated once per block of rows, and each row is written once, straight into X
+
+template<typename eT, typename mT, typename vT, typename cT>
+statslib_inline
+void
+rmvnorm_fill(mT& X, const ullint_t n, const vT& mu_par, const cT& A, rand_engine_t& engine)
+{
+    const rmvnorm_chol_t<eT> st = rmvnorm_chol_setup<eT>(mu_par,A);
+    const ullint_t K = st.K;
+
+    mat_ops::resize(X,n,K);
+
+    // per row: K normal draws, then K(K+1)/2 multiply-adds at about a nanosecond each
+    const ullint_t row_cost = K*STATS_OMP_COST_rnorm_vec_compute + K*(K+1U)/2U;
+
+    rand_run_blocks(n,engine,
+        [&](const ullint_t i_begin, const ullint_t i_end, rand_engine_t& engine_b)
+        {
+            std::vector<eT> z(K);
+
+            for (ullint_t i = i_begin; i < i_end; ++i)
+            {
+                for (ullint_t j = 0U; j < K; ++j) {
+                    z[j] = zig_norm<eT>(engine_b);
+                }
+
+                rmvnorm_chol_row(st,z.data(),X,i);
+            }
+        },
+        row_cost);
+}
+
+// as above, with z_i the normal quantiles of the i-th point of a low-discrepancy sequence, computed in place
+// in the sequence buffer
+
+template<typename eT, typename mT, typename vT, typename cT, typename sT>
+statslib_inline
+void
+rmvnorm_qmc_fill(mT& X, const ullint_t n, const vT& mu_par, const cT& A, sT& seq)
+{
+    const rmvnorm_chol_t<eT> st = rmvnorm_chol_setup<eT>(mu_par,A);
+    const ullint_t K = st.K;
+
+    mat_ops::resize(X,n,K);
+
+    const ullint_t row_cost = K*STATS_OMP_COST_qnorm + K*(K+1U)/2U;
+
+    qmc_run_vec<eT>(n,seq,
+        [&](const ullint_t i, eT* unit_vals)
+        {
+            for (ullint_t j = 0U; j < K; ++j) {
+                unit_vals[j] = qnorm(unit_vals[j]);
+            }
+
+            rmvnorm_chol_row(st,unit_vals,X,i);
+        },
+        row_cost);
+}
+
+}
+
 template<typename vT, typename mT, typename not_arma_mat<mT>::type*>
 statslib_inline
 mT
@@ -98,9 +221,11 @@ rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, rand_engine_t&
 
     //
 
+    typedef typename std::decay<decltype(Sigma_par(0,0))>::type eT;
+
     const mT A = (pre_chol) ? Sigma_par : mat_ops::chol(Sigma_par); // should be lower-triangular
 
-    ret = mat_ops::repmat(mat_ops::trans(mu_par),n,1) + rnorm<mT>(n,K,engine) * mat_ops::trans(A);
+    internal::rmvnorm_fill<eT>(ret,n,mu_par,A,engine);
 
     //
     
@@ -128,11 +253,38 @@ rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, rand_e
 
     const ArmaMat<eT> A = (pre_chol) ? Sigma_par : arma::chol(Sigma_par,"lower"); // should be lower-triangular
 
-    // ret = arma::repmat(mu_par.t(),n,1) + rnorm<ArmaMat<eT>>(n,K) * A.t();
-    ret = arma::repmat(mu_par.t(),n,1) + arma::randn<ArmaMat<eT>>(n,K,engine) * A.t();
+    internal::rmvnorm_fill<eT>(ret,n,mu_par,A,engine);
 
     //
     
     return ret;
 }
 #endif
+
+template<typename vT, typename mT, typename sT, typename std::enable_if<internal::is_qmc_seq<sT>::value>::type*>
+statslib_inline
+mT
+rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, sT& seq, const bool pre_chol)
+{
+    mT ret;
+
+    const ullint_t K = mat_ops::n_rows(Sigma_par);
+
+    if (mat_ops::n_elem(mu_par) != K || seq.dim() != K)
+    {
+        printf("rmvnorm: dimensions of mu, Sigma, and the sequence do not agree.\n");
+        return ret;
+    }
+
+    //
+
+    typedef typename std::decay<decltype(Sigma_par(0,0))>::type eT;
+
+    const mT A = (pre_chol) ? Sigma_par : mat_ops::chol(Sigma_par); // should be lower-triangular
+
+    internal::rmvnorm_qmc_fill<eT>(ret,n,mu_par,A,seq);
+
+    //
+    
+    return ret;
+}
@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * Random sampling function for the Normal distribution
@@ -67,7 +67,7 @@ rnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 /**
  * Random sampling function for the standard Normal distribution
@@ -119,7 +119,43 @@ T rnorm();
 template<typename mT, typename T1 = double, typename T2 = double>
 statslib_inline
 mT
-rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
+
+/**
+ * @brief Random matrix sampling function for the Normal distribution, with a variance-reduced sampling mode
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ * @param mode the sampling mode; see \c rand_mode.
+ *
+ * @return a matrix of pseudo-random draws from the Normal distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rnorm<std::vector<double>>(5,4,1.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Armadillo matrix
+ * stats::rnorm<arma::mat>(5,4,1.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Blaze dynamic matrix
+ * stats::rnorm<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,1.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Eigen dynamic matrix
+ * stats::rnorm<Eigen::MatrixXd>(5,4,1.0,2.0,engine,stats::rand_mode::antithetic);
+ * \endcode
+ *
+ * @note Draws are generated by inversion, column by column: with \c rand_mode::antithetic, row i + floor(n/2) is the antithetic partner of row i;
+ * with \c rand_mode::stratified, the rows form a Latin hypercube sample.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine, const rand_mode mode);
 
 /**
  * @brief Random matrix sampling function for the Normal distribution
@@ -150,7 +186,7 @@ rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, r
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the standard Normal distribution
@@ -180,7 +216,7 @@ rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, c
 template<typename mT, typename sT = double>
 statslib_inline
 mT
-rnorm(const ullint_t n, const ullint_t k, rand_engine_t& engine);
+rnorm(const ullint_t n, const ullint_t k, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the standard Normal distribution
@@ -209,7 +245,7 @@ rnorm(const ullint_t n, const ullint_t k, rand_engine_t& engine);
 template<typename mT, typename sT = double>
 statslib_inline
 mT
-rnorm(const ullint_t n, const ullint_t k, const ullint_t seed_val = std::random_device{}());
+rnorm(const ullint_t n, const ullint_t k, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
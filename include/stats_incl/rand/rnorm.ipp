@@ -28,6 +28,47 @@
 namespace internal
 {
 
+// standard normal quantile of a (0,1) draw, for the sampling modes that need a monotone transform:
+// the rational approximation of Acklam (relative error below 1.2e-9) in the lower half, refined by one
+// Halley step, then reflected
+
+template<typename T>
+statslib_inline
+T
+rnorm_from_unit(const T unit_val, const T mu_par, const T sigma_par)
+{
+    const T p = std::min(unit_val, T(1) - unit_val);
+
+    T x;
+
+    if (p < T(0.02425))
+    {
+        const T q = std::sqrt(- T(2)*std::log(p));
+
+        x = (((((T(-7.784894002430293e-03)*q + T(-3.223964580411365e-01))*q + T(-2.400758277161838e+00))*q 
+                + T(-2.549732539343734e+00))*q + T(4.374664141464968e+00))*q + T(2.938163982698783e+00))
+            / ((((T(7.784695709041462e-03)*q + T(3.224671290700398e-01))*q + T(2.445134137142996e+00))*q 
+                + T(3.754408661907416e+00))*q + T(1));
+    }
+    else
+    {
+        const T q = p - T(0.5);
+        const T r = q*q;
+
+        x = (((((T(-3.969683028665376e+01)*r + T(2.209460984245205e+02))*r + T(-2.759285104469687e+02))*r 
+                + T(1.383577518672690e+02))*r + T(-3.066479806614716e+01))*r + T(2.506628277459239e+00))*q
+            / (((((T(-5.447609879822406e+01)*r + T(1.615858368580409e+02))*r + T(-1.556989798598866e+02))*r 
+                + T(6.680131188771972e+01))*r + T(-1.328068155288572e+01))*r + T(1));
+    }
+
+    const T err = T(0.5)*std::erfc(- x / T(GCEM_SQRT_2)) - p;
+    const T h = err * T(2*GCEM_SQRT_HALF_PI) * std::exp(x*x / T(2));
+
+    x -= h / (T(1) + x*h / T(2));
+
+    return mu_par + sigma_par*std::copysign(x, unit_val - T(0.5));
+}
+
 template<typename T>
 statslib_inline
 T
@@ -39,9 +80,7 @@ rnorm_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
 
     //
 
-    std::normal_distribution<T> norm_dist(T(0),T(1));
-
-    return mu_par + sigma_par*norm_dist(engine);
+    return mu_par + sigma_par*zig_norm<T>(engine);
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -85,13 +124,30 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename T>
+statslib_inline
+T
+rnorm_vec_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
+{
+    return mu_par + sigma_par*zig_norm<T>(engine);
+}
+
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
 rnorm_vec(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine_0, 
           rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rnorm,vals_out,num_elem,engine_0,mu_par,sigma_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!norm_sanity_check(static_cast<TC>(mu_par),static_cast<TC>(sigma_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    RAND_DIST_FN_VEC(rnorm_vec_compute,vals_out,num_elem,engine_0,static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
 }
 #endif
 
@@ -151,4 +207,14 @@ rnorm(const ullint_t n, const ullint_t k, const ullint_t seed_val)
     rand_engine_t engine(seed_val);
     GEN_MAT_RAND_FN(rnorm_mat_check,sT(0),sT(1),engine);
 }
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rand_engine_t& engine, const rand_mode mode)
+{
+    typedef common_return_t<T1,T2> TC;
+
+    GEN_MAT_RAND_MODE_FN(TC,internal::norm_sanity_check(static_cast<TC>(mu_par),static_cast<TC>(sigma_par)),rnorm_from_unit,static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
+}
 #endif
@@ -46,7 +46,7 @@
 template<typename T>
 statslib_inline
 return_t<T>
-rpois(const T rate_par, rand_engine_t& engine);
+rpois(const T rate_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Poisson distribution
@@ -65,7 +65,7 @@ rpois(const T rate_par, rand_engine_t& engine);
 template<typename T>
 statslib_inline
 return_t<T>
-rpois(const T rate_par, const ullint_t seed_val = std::random_device{}());
+rpois(const T rate_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -101,7 +101,7 @@ rpois(const T rate_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rpois(const ullint_t n, const ullint_t k, const T1 rate_par, rand_engine_t& engine);
+rpois(const ullint_t n, const ullint_t k, const T1 rate_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for the Poisson distribution
@@ -131,7 +131,7 @@ rpois(const ullint_t n, const ullint_t k, const T1 rate_par, rand_engine_t& engi
 template<typename mT, typename T1>
 statslib_inline
 mT
-rpois(const ullint_t n, const ullint_t k, const T1 rate_par, const ullint_t seed_val = std::random_device{}());
+rpois(const ullint_t n, const ullint_t k, const T1 rate_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
@@ -20,6 +20,9 @@
 
 /* 
  * Sample from a Poisson distribution
+ *
+ * For rate < 10, sequential inversion is used; otherwise, the PTRS
+ * transformed rejection method of Hormann (1993) is used.
  */
 
 //
@@ -28,15 +31,107 @@
 namespace internal
 {
 
-template<typename T>
+// constants that depend only on the rate; computed once per rate value
+
+struct rpois_setup_t
+{
+    double rate;
+    bool use_ptrs;
+
+    // inversion
+    double exp_neg_rate;
+
+    // PTRS
+    double log_rate, b, a, log_inv_alpha, v_r;
+};
+
+statslib_inline
+rpois_setup_t
+rpois_setup(const double rate_par)
+{
+    rpois_setup_t st;
+
+    st.rate = rate_par;
+    st.use_ptrs = (rate_par >= 10.0);
+
+    if (!st.use_ptrs) {
+        st.exp_neg_rate = stmath::exp(-rate_par);
+    } else {
+        const double sqrt_rate = stmath::sqrt(rate_par);
+
+        st.log_rate = stmath::log(rate_par);
+        st.b = 0.931 + 2.53 * sqrt_rate;
+        st.a = -0.059 + 0.02483 * st.b;
+        st.log_inv_alpha = stmath::log(1.1239 + 1.1328 / (st.b - 3.4));
+        st.v_r = 0.9277 - 3.6224 / (st.b - 2.0);
+    }
+
+    return st;
+}
+
+statslib_inline
+double
+rpois_inversion(const rpois_setup_t& st, rand_engine_t& engine)
+{
+    double x = 0;
+    double px = st.exp_neg_rate;
+    double u = u64_to_unit_co(rand_u64(engine));
+
+    while (u > px) {
+        x += 1.0;
+
+        if (px == 0.0) {
+            // remaining mass lost to rounding; restart
+            x = 0;
+            px = st.exp_neg_rate;
+            u = u64_to_unit_co(rand_u64(engine));
+        } else {
+            u -= px;
+            px *= st.rate / x;
+        }
+    }
+
+    return x;
+}
+
+statslib_inline
+double
+rpois_ptrs(const rpois_setup_t& st, rand_engine_t& engine)
+{
+    while (true) {
+        const double u = u64_to_unit_co(rand_u64(engine)) - 0.5;
+        const double v = u64_to_unit_oo(rand_u64(engine));
+        const double us = 0.5 - std::abs(u);
+        const double k = std::floor((2.0 * st.a / us + st.b) * u + st.rate + 0.43);
+
+        if (us >= 0.07 && v <= st.v_r) {
+            return k;
+        }
+
+        if (k < 0.0 || (us < 0.013 && v > us)) {
+            continue;
+        }
+
+        if (stmath::log(v) + st.log_inv_alpha - stmath::log(st.a / (us * us) + st.b) 
+                <= - st.rate + k * st.log_rate - stmath::lgamma(k + 1.0)) {
+            return k;
+        }
+    }
+}
+
 statslib_inline
-T
-rpois_compute(const T rate_par, rand_engine_t& engine)
+double
+rpois_draw(const rpois_setup_t& st, rand_engine_t& engine)
 {
-    return( !pois_sanity_check(rate_par) ? \
-                STLIM<T>::quiet_NaN() :
-            //
-            qpois(runif(T(0),T(1),engine),rate_par) );
+    if (st.rate == 0.0) {
+        return 0.0;
+    }
+
+    if (GCINT::is_posinf(st.rate)) {
+        return st.rate;
+    }
+
+    return st.use_ptrs ? rpois_ptrs(st,engine) : rpois_inversion(st,engine);
 }
 
 }
@@ -46,7 +141,15 @@ statslib_inline
 return_t<T>
 rpois(const T rate_par, rand_engine_t& engine)
 {
-    return internal::rpois_compute(static_cast<return_t<T>>(rate_par),engine);
+    if (!internal::pois_sanity_check(rate_par)) {
+        return STLIM<return_t<T>>::quiet_NaN();
+    }
+
+    //
+
+    const internal::rpois_setup_t st = internal::rpois_setup(static_cast<double>(rate_par));
+
+    return static_cast<return_t<T>>( internal::rpois_draw(st,engine) );
 }
 
 template<typename T>
@@ -71,7 +174,16 @@ void
 rpois_vec(const T1 rate_par, rand_engine_t& engine_0, 
           rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rpois,vals_out,num_elem,engine_0,rate_par);
+    if (!pois_sanity_check(rate_par)) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    // setup is computed once and shared by all draws in the batch
+
+    const rpois_setup_t st = rpois_setup(static_cast<double>(rate_par));
+
+    RAND_DIST_FN_VEC(rpois_draw,vals_out,num_elem,engine_0,st);
 }
 #endif
 
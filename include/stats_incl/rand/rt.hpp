@@ -46,7 +46,7 @@
 template<typename T>
 statslib_inline
 return_t<T>
-rt(const T dof_par, rand_engine_t& engine);
+rt(const T dof_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for Student's t-distribution
@@ -65,7 +65,7 @@ rt(const T dof_par, rand_engine_t& engine);
 template<typename T>
 statslib_inline
 return_t<T>
-rt(const T dof_par, const ullint_t seed_val = std::random_device{}());
+rt(const T dof_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -101,7 +101,7 @@ rt(const T dof_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rt(const ullint_t n, const ullint_t k, const T1 dof_par, rand_engine_t& engine);
+rt(const ullint_t n, const ullint_t k, const T1 dof_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random matrix sampling function for Student's t-distribution
@@ -131,7 +131,7 @@ rt(const ullint_t n, const ullint_t k, const T1 dof_par, rand_engine_t& engine);
 template<typename mT, typename T1>
 statslib_inline
 mT
-rt(const ullint_t n, const ullint_t k, const T1 dof_par, const ullint_t seed_val = std::random_device{}());
+rt(const ullint_t n, const ullint_t k, const T1 dof_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
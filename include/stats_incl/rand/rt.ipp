@@ -28,6 +28,40 @@
 namespace internal
 {
 
+template<typename T>
+struct rt_setup_t
+{
+    T dof;
+    rchisq_setup_t<T> chisq_st;
+};
+
+template<typename T>
+statslib_inline
+rt_setup_t<T>
+rt_setup(const T dof_par)
+{
+    rt_setup_t<T> st;
+
+    st.dof = dof_par;
+    st.chisq_st = rchisq_setup(dof_par);
+
+    return st;
+}
+
+template<typename T>
+statslib_inline
+T
+rt_draw(const rt_setup_t<T>& st, rand_engine_t& engine)
+{
+    const T Z = zig_norm<T>(engine);
+
+    if (st.chisq_st.inf_dof) {
+        return Z;
+    }
+
+    return Z / std::sqrt( rchisq_draw(st.chisq_st,engine) / st.dof );
+}
+
 template<typename T>
 statslib_inline
 T
@@ -39,9 +73,7 @@ rt_compute(const T dof_par, rand_engine_t& engine)
 
     //
 
-    T numer = rnorm(T(0),T(1),engine);
-    
-    return numer / std::sqrt( rchisq(dof_par,engine) / dof_par );
+    return rt_draw(rt_setup(dof_par),engine);
 }
 
 }
@@ -76,7 +108,20 @@ void
 rt_vec(const T1 dof_par, rand_engine_t& engine_0, 
        rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rt,vals_out,num_elem,engine_0,dof_par);
+    typedef return_t<T1> TC;
+
+    // parameters are checked once per batch
+
+    if (!t_sanity_check(static_cast<TC>(dof_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    // setup is computed once and shared by all draws in the batch
+
+    const rt_setup_t<TC> st = rt_setup(static_cast<TC>(dof_par));
+
+    RAND_DIST_FN_VEC(rt_draw,vals_out,num_elem,engine_0,st);
 }
 #endif
 
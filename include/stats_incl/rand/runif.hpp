@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-runif(const T1 a_par, const T2 b_par, rand_engine_t& engine);
+runif(const T1 a_par, const T2 b_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Uniform distribution
@@ -67,7 +67,7 @@ runif(const T1 a_par, const T2 b_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-runif(const T1 a_par, const T2 b_par, const ullint_t seed_val = std::random_device{}());
+runif(const T1 a_par, const T2 b_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 /**
  * @brief Random sampling function for the Uniform distribution on the unit interval
@@ -119,7 +119,43 @@ T runif();
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rand_engine_t& engine);
+runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
+
+/**
+ * @brief Random matrix sampling function for the Uniform distribution, with a variance-reduced sampling mode
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param a_par the lower bound parameter, a real-valued input.
+ * @param b_par the upper bound parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ * @param mode the sampling mode; see \c rand_mode.
+ *
+ * @return a matrix of pseudo-random draws from the Uniform distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::runif<std::vector<double>>(5,4,-1.0,3.0,engine,stats::rand_mode::antithetic);
+ * // Armadillo matrix
+ * stats::runif<arma::mat>(5,4,-1.0,3.0,engine,stats::rand_mode::antithetic);
+ * // Blaze dynamic matrix
+ * stats::runif<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,-1.0,3.0,engine,stats::rand_mode::antithetic);
+ * // Eigen dynamic matrix
+ * stats::runif<Eigen::MatrixXd>(5,4,-1.0,3.0,engine,stats::rand_mode::antithetic);
+ * \endcode
+ *
+ * @note Draws are generated by inversion, column by column: with \c rand_mode::antithetic, row i + floor(n/2) is the antithetic partner of row i;
+ * with \c rand_mode::stratified, the rows form a Latin hypercube sample.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rand_engine_t& engine, const rand_mode mode);
 
 /**
  * @brief Random matrix sampling function for the Uniform distribution
@@ -150,7 +186,7 @@ runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rand_e
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, const ullint_t seed_val = std::random_device{}());
+runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
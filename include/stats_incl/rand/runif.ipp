@@ -28,6 +28,32 @@
 namespace internal
 {
 
+// map a (0,1) draw to (a,b). a + (b - a) u can round to either endpoint, so the result is clamped to
+// [lo_val, hi_val], the neighbours of a and b inside the interval; see runif_bounds
+
+template<typename T>
+statslib_constexpr
+T
+runif_from_unit(const T unit_val, const T a_par, const T b_par, const T lo_val, const T hi_val)
+noexcept
+{
+    return( a_par + (b_par - a_par)*unit_val < lo_val ? \
+                lo_val :
+            a_par + (b_par - a_par)*unit_val > hi_val ? \
+                hi_val :
+            //
+            a_par + (b_par - a_par)*unit_val );
+}
+
+template<typename T>
+statslib_inline
+void
+runif_bounds(const T a_par, const T b_par, T& lo_val, T& hi_val)
+{
+    lo_val = std::nextafter(a_par,b_par);
+    hi_val = std::nextafter(b_par,a_par);
+}
+
 template<typename T>
 statslib_inline
 T
@@ -36,13 +62,11 @@ runif_compute(const T a_par, const T b_par, rand_engine_t& engine)
     if (!unif_sanity_check(a_par,b_par)) {
         return STLIM<T>::quiet_NaN();
     }
-    
-    // convert from [a,b) to (a,b)
 
-    T a_par_adj = std::nextafter(a_par, b_par);
-    std::uniform_real_distribution<T> unif_dist(a_par_adj, b_par);
+    T lo_val, hi_val;
+    runif_bounds(a_par,b_par,lo_val,hi_val);
 
-    return unif_dist(engine);
+    return runif_from_unit(u64_to_unit_oo<T>(rand_u64(engine)),a_par,b_par,lo_val,hi_val);
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -93,7 +117,19 @@ void
 runif_vec(const T1 a_par, const T2 b_par, rand_engine_t& engine_0, 
           rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(runif,vals_out,num_elem,engine_0,a_par,b_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!unif_sanity_check(static_cast<TC>(a_par),static_cast<TC>(b_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    TC lo_val, hi_val;
+    runif_bounds(static_cast<TC>(a_par),static_cast<TC>(b_par),lo_val,hi_val);
+
+    RAND_UNIT_FN_VEC(TC,runif_from_unit,vals_out,num_elem,engine_0,static_cast<TC>(a_par),static_cast<TC>(b_par),lo_val,hi_val);
 }
 #endif
 
@@ -136,4 +172,17 @@ runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, const
     rand_engine_t engine(seed_val);
     GEN_MAT_RAND_FN(runif_mat_check,a_par,b_par,engine);
 }
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rand_engine_t& engine, const rand_mode mode)
+{
+    typedef common_return_t<T1,T2> TC;
+
+    TC lo_val, hi_val;
+    internal::runif_bounds(static_cast<TC>(a_par),static_cast<TC>(b_par),lo_val,hi_val);
+
+    GEN_MAT_RAND_MODE_FN(TC,internal::unif_sanity_check(static_cast<TC>(a_par),static_cast<TC>(b_par)),runif_from_unit,static_cast<TC>(a_par),static_cast<TC>(b_par),lo_val,hi_val);
+}
 #endif
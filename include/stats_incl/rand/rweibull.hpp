@@ -47,7 +47,7 @@
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rweibull(const T1 shape_par, const T2 scale_par, rand_engine_t& engine);
+rweibull(const T1 shape_par, const T2 scale_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
 
 /**
  * @brief Random sampling function for the Weibull distribution
@@ -67,7 +67,7 @@ rweibull(const T1 shape_par, const T2 scale_par, rand_engine_t& engine);
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rweibull(const T1 shape_par, const T2 scale_par, const ullint_t seed_val = std::random_device{}());
+rweibull(const T1 shape_par, const T2 scale_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 //
 // vector/matrix output
@@ -104,7 +104,43 @@ rweibull(const T1 shape_par, const T2 scale_par, const ullint_t seed_val = std::
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, rand_engine_t& engine);
+rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, rand_engine_t& engine STATS_RAND_ENGINE_DEFAULT);
+
+/**
+ * @brief Random matrix sampling function for the Weibull distribution, with a variance-reduced sampling mode
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ * @param mode the sampling mode; see \c rand_mode.
+ *
+ * @return a matrix of pseudo-random draws from the Weibull distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rweibull<std::vector<double>>(5,4,3.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Armadillo matrix
+ * stats::rweibull<arma::mat>(5,4,3.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Blaze dynamic matrix
+ * stats::rweibull<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,3.0,2.0,engine,stats::rand_mode::antithetic);
+ * // Eigen dynamic matrix
+ * stats::rweibull<Eigen::MatrixXd>(5,4,3.0,2.0,engine,stats::rand_mode::antithetic);
+ * \endcode
+ *
+ * @note Draws are generated by inversion, column by column: with \c rand_mode::antithetic, row i + floor(n/2) is the antithetic partner of row i;
+ * with \c rand_mode::stratified, the rows form a Latin hypercube sample.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, rand_engine_t& engine, const rand_mode mode);
 
 /**
  * @brief Random matrix sampling function for the Weibull distribution
@@ -135,7 +171,7 @@ rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, const ullint_t seed_val = std::random_device{}());
+rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, const ullint_t seed_val STATS_RAND_SEED_DEFAULT);
 
 #endif
 
@@ -28,15 +28,33 @@
 namespace internal
 {
 
+// quantile transform of a (0,1) draw, with U in place of 1 - U; the parameters are checked by the caller
+
+template<typename T>
+statslib_inline
+T
+rweibull_from_unit(const T unit_val, const T inv_shape_par, const T scale_par)
+{
+    return scale_par*std::pow(- std::log(unit_val), inv_shape_par);
+}
+
+template<typename T>
+statslib_inline
+bool
+rweibull_par_check(const T shape_par, const T scale_par)
+{
+    return weibull_sanity_check(shape_par,scale_par) && shape_par != T(0);
+}
+
 template<typename T>
 statslib_inline
 T
 rweibull_compute(const T shape_par, const T scale_par, rand_engine_t& engine)
 {
-    return( !weibull_sanity_check(shape_par,scale_par) ? \
+    return( !rweibull_par_check(shape_par,scale_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qweibull(runif(T(0),T(1),engine),shape_par,scale_par) );
+            rweibull_from_unit(u64_to_unit_oo<T>(rand_u64(engine)),T(1)/shape_par,scale_par) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -80,7 +98,16 @@ void
 rweibull_vec(const T1 shape_par, const T2 scale_par, rand_engine_t& engine_0, 
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rweibull,vals_out,num_elem,engine_0,shape_par,scale_par);
+    typedef common_return_t<T1,T2> TC;
+
+    // parameters are checked once per batch
+
+    if (!rweibull_par_check(static_cast<TC>(shape_par),static_cast<TC>(scale_par))) {
+        std::fill(vals_out, vals_out + num_elem, STLIM<rT>::quiet_NaN());
+        return;
+    }
+
+    RAND_UNIT_FN_VEC(TC,rweibull_from_unit,vals_out,num_elem,engine_0,TC(1)/static_cast<TC>(shape_par),static_cast<TC>(scale_par));
 }
 #endif
 
@@ -123,4 +150,14 @@ rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_
     rand_engine_t engine(seed_val);
     GEN_MAT_RAND_FN(rweibull_mat_check,shape_par,scale_par,engine);
 }
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, rand_engine_t& engine, const rand_mode mode)
+{
+    typedef common_return_t<T1,T2> TC;
+
+    GEN_MAT_RAND_MODE_FN(TC,internal::rweibull_par_check(static_cast<TC>(shape_par),static_cast<TC>(scale_par)),rweibull_from_unit,TC(1)/static_cast<TC>(shape_par),static_cast<TC>(scale_par));
+}
 #endif
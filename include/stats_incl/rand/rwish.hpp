@@ -49,6 +49,23 @@ statslib_inline
 mT rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_chol = false);
 #endif
 
+/**
+ * @brief Random sampling function for the Wishart distribution
+ *
+ * @param n number of (independent) samples to draw.
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ * @param pre_chol indicate whether \c Psi_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return a contiguous buffer of \c n draws, each a \c K by \c K matrix in column-major order; draw \c m starts at element \c m*K*K.
+ */
+
+// n samples
+template<typename mT, typename pT>
+statslib_inline
+std::vector<return_t<pT>> rwish(const ullint_t n, const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_chol = false);
+
 #include "rwish.ipp"
 
 #endif
@@ -22,13 +22,204 @@
  * Sample from a Wishart distribution
  */
 
+namespace internal
+{
+
+// Bartlett decomposition. With L the lower Cholesky factor of Psi and T a lower-triangular matrix with
+// T(j,j)^2 ~ chi^2(nu - j) and T(i,j) ~ N(0,1) below the diagonal, W = (L T)(L T)' ~ Wishart(Psi, nu).
+//
+// For the inverse-Wishart, T(j,j)^2 ~ chi^2(nu - K + 1 + j) instead, and X = (L T^{-1})(L T^{-1})':
+// this is the Bartlett factor of the reversed coordinates, so X^{-1} ~ Wishart(Psi^{-1}, nu) with
+// only triangular products and solves.
+//
+// The factor L and the chi-squared setups depend only on (Psi, nu), and are shared by all draws.
+
+template<typename eT>
+struct rwish_setup_t
+{
+    ullint_t K;
+    bool inverse;
+    bool valid;
+
+    std::vector<eT> chol_Psi; // K x K, column-major, lower triangle
+    std::vector<rchisq_setup_t<eT>> chisq_st;
+};
+
+template<typename eT, typename mT>
+statslib_inline
+rwish_setup_t<eT>
+rwish_setup(const mT& chol_Psi, const eT nu_par, const bool inverse)
+{
+    rwish_setup_t<eT> st;
+
+    const ullint_t K = mat_ops::n_rows(chol_Psi);
+
+    st.K = K;
+    st.inverse = inverse;
+    st.valid = (K > 0U) && (nu_par > eT(K) - eT(1)) && !GCINT::is_inf(nu_par);
+
+    st.chol_Psi.assign(K*K, eT(0));
+
+    for (ullint_t j = 0U; j < K; ++j) {
+        for (ullint_t i = j; i < K; ++i) {
+            st.chol_Psi[i + j*K] = chol_Psi(i,j);
+        }
+    }
+
+    for (ullint_t j = 0U; j < K; ++j) {
+        st.chisq_st.push_back( rchisq_setup(inverse ? nu_par - eT(K) + eT(1) + eT(j) : nu_par - eT(j)) );
+    }
+
+    return st;
+}
+
+// one draw, written to the K x K column-major block vals_out; work holds 2*K*K elements
+
+template<typename eT>
+statslib_inline
+void
+rwish_draw(const rwish_setup_t<eT>& st, rand_engine_t& engine, 
+           eT* __stats_pointer_settings__ vals_out, eT* __stats_pointer_settings__ work)
+{
+    const ullint_t K = st.K;
+    const eT* L = st.chol_Psi.data();
+
+    eT* T = work;
+    eT* B = work + K*K;
+
+    // Bartlett factor
+
+    for (ullint_t j = 0U; j < K; ++j)
+    {
+        T[j + j*K] = std::sqrt( rchisq_draw(st.chisq_st[j],engine) );
+
+        for (ullint_t i = j + 1U; i < K; ++i) {
+            T[i + j*K] = zig_norm<eT>(engine);
+        }
+    }
+
+    if (!st.inverse) {
+        // B = L T, lower-triangular
+
+        for (ullint_t j = 0U; j < K; ++j) {
+            for (ullint_t i = j; i < K; ++i)
+            {
+                eT b_ij = eT(0);
+
+                for (ullint_t l = j; l <= i; ++l) {
+                    b_ij += L[i + l*K] * T[l + j*K];
+                }
+
+                B[i + j*K] = b_ij;
+            }
+        }
+    } else {
+        // B = L T^{-1}: solve B T = L one row at a time, by back substitution
+
+        for (ullint_t i = 0U; i < K; ++i) {
+            for (ullint_t j = i + 1U; j-- > 0U; )
+            {
+                eT b_ij = L[i + j*K];
+
+                for (ullint_t l = j + 1U; l <= i; ++l) {
+                    b_ij -= B[i + l*K] * T[l + j*K];
+                }
+
+                B[i + j*K] = b_ij / T[j + j*K];
+            }
+        }
+    }
+
+    // B B', symmetric
+
+    for (ullint_t j = 0U; j < K; ++j) {
+        for (ullint_t i = j; i < K; ++i)
+        {
+            eT x_ij = eT(0);
+
+            for (ullint_t l = 0U; l <= j; ++l) {
+                x_ij += B[i + l*K] * B[j + l*K];
+            }
+
+            vals_out[i + j*K] = x_ij;
+            vals_out[j + i*K] = x_ij;
+        }
+    }
+}
+
+// n draws in a contiguous n*K*K buffer, in parallel across draws
+
+template<typename eT>
+statslib_inline
+std::vector<eT>
+rwish_batch(const ullint_t n, const rwish_setup_t<eT>& st, rand_engine_t& engine)
+{
+    const ullint_t KK = st.K * st.K;
+
+    std::vector<eT> vals_out(n*KK);
+
+    if (!st.valid) {
+        std::fill(vals_out.begin(), vals_out.end(), STLIM<eT>::quiet_NaN());
+        return vals_out;
+    }
+
+    eT* vals_ptr = vals_out.data();
+
+    // per draw: K(K-1)/2 normal and K chi-squared draws, then about K^3/2 multiply-adds for the two products
+    const ullint_t draw_cost = (KK/2U)*STATS_OMP_COST_rnorm_vec_compute + st.K*STATS_OMP_COST_rchisq_draw + KK*st.K/2U;
+
+    // scratch space for the triangular factors is allocated once per block of draws
+
+    rand_run_blocks(n,engine,
+        [&](const ullint_t m_begin, const ullint_t m_end, rand_engine_t& engine_b)
+        {
+            std::vector<eT> work(2*KK);
+
+            for (ullint_t m = m_begin; m < m_end; ++m) {
+                rwish_draw(st,engine_b,vals_ptr + m*KK,work.data());
+            }
+        },
+        draw_cost);
+
+    return vals_out;
+}
+
+// single draw into a K x K matrix
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+rwish_single(const rwish_setup_t<eT>& st, rand_engine_t& engine)
+{
+    const ullint_t K = st.K;
+
+    std::vector<eT> vals(K*K, STLIM<eT>::quiet_NaN());
+    std::vector<eT> work(2*K*K);
+
+    if (st.valid) {
+        rwish_draw(st,engine,vals.data(),work.data());
+    }
+
+    mT ret;
+    mat_ops::resize(ret,K,K);
+
+    for (ullint_t j = 0U; j < K; ++j) {
+        for (ullint_t i = 0U; i < K; ++i) {
+            ret(i,j) = vals[i + j*K];
+        }
+    }
+
+    return ret;
+}
+
+}
+
 template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
 statslib_inline
 mT
 rwish(const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_chol)
 {
     typedef return_t<pT> eT;
-    const ullint_t K = mat_ops::n_rows(Psi_par);
     
     mT chol_Psi;
     if (pre_chol) {
@@ -38,25 +229,8 @@ rwish(const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_
     }
 
     //
-
-    mT A;
-    mat_ops::zeros(A,K,K);
-
-    for (ullint_t i=1U; i < K; i++) {
-        for (ullint_t j=0U; j < i; j++) {
-            A(i,j) = rnorm<eT>(eT(0),eT(1),engine);
-        }
-    }
     
-    for (ullint_t i=0U; i < K; i++) {
-        A(i,i) = std::sqrt(rchisq<eT>(eT(nu_par-i),engine));
-    }
-
-    chol_Psi = chol_Psi*A;
-
-    //
-    
-    return chol_Psi * mat_ops::trans(chol_Psi);
+    return internal::rwish_single<mT>(internal::rwish_setup(chol_Psi,static_cast<eT>(nu_par),false),engine);
 }
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
@@ -65,28 +239,27 @@ statslib_inline
 mT
 rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_chol)
 {
-    const ullint_t K = Psi_par.n_rows;
-    
     ArmaMat<eT> chol_Psi = (pre_chol) ? Psi_par : arma::chol(Psi_par,"lower"); // should be lower-triangular
 
     //
+    
+    return internal::rwish_single<mT>(internal::rwish_setup(chol_Psi,static_cast<eT>(nu_par),false),engine);
+}
+#endif
 
-    ArmaMat<eT> A = arma::zeros(K,K);
+//
+// n-samples: results will be a contiguous n*K*K buffer
 
-    for (ullint_t i=1U; i < K; i++) {
-        for (ullint_t j=0U; j < i; j++) {
-            A(i,j) = rnorm<eT>(eT(0),eT(1),engine);
-        }
-    }
-    
-    for (ullint_t i=0U; i < K; i++) {
-        A(i,i) = std::sqrt(rchisq<eT>(eT(nu_par-i),engine));
-    }
+template<typename mT, typename pT>
+statslib_inline
+std::vector<return_t<pT>>
+rwish(const ullint_t n, const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_chol)
+{
+    typedef return_t<pT> eT;
 
-    chol_Psi = chol_Psi*A;
+    const mT chol_Psi = (pre_chol) ? Psi_par : mat_ops::chol(Psi_par); // should be lower-triangular
 
-    //
-    
-    return chol_Psi * chol_Psi.t();
+    // setup is computed once and shared by all draws in the batch
+
+    return internal::rwish_batch(n,internal::rwish_setup(chol_Psi,static_cast<eT>(nu_par),false),engine);
 }
-#endif
@@ -0,0 +1,113 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sobol low-discrepancy sequence, with optional random linear scrambling
+ */
+
+#ifndef _statslib_sobol_seq_HPP
+#define _statslib_sobol_seq_HPP
+
+/**
+ * @brief Sobol low-discrepancy sequence on the unit cube
+ *
+ * Points are generated in Gray-code order from the direction numbers of Joe and Kuo (2008), with 64 bits
+ * of precision in every coordinate, for dimensions 1 to sobol_seq::max_dim(). Any point can be computed
+ * directly from its index, so seeking to a position takes O(d) time; this is how a sequence is split
+ * into parallel chunks.
+ *
+ * With scrambling, each coordinate is multiplied by a random lower-triangular binary matrix and given a
+ * random digital shift (Matousek, 1998). Scrambled points are uniform on (0,1)^d while keeping the net
+ * structure of the sequence, and replicates with different seeds give error estimates. Without scrambling
+ * the first point is the origin, which is mapped to the smallest value above zero.
+ *
+ * If the dimension is zero or exceeds max_dim(), the sequence is empty.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::sobol_seq seq(2, true, 1776);
+ * std::vector<double> u(1024 * 2);
+ * seq.fill(u.data(), 1024); // 1024 points, stored point by point
+ * \endcode
+ */
+
+class sobol_seq
+{
+    public:
+        sobol_seq() = default;
+
+        /**
+         * @param dim_val the dimension of each point.
+         * @param scramble whether to apply a random linear scramble and digital shift.
+         * @param seed_val the seed value of the scramble.
+         */
+
+        explicit sobol_seq(const ullint_t dim_val, const bool scramble = false, const ullint_t seed_val = 0);
+
+        /**
+         * @return the largest supported dimension.
+         */
+
+        static constexpr ullint_t max_dim() noexcept { return 21; }
+
+        /**
+         * @return the dimension of each point, or zero if the sequence is empty.
+         */
+
+        ullint_t dim() const noexcept { return shift_.size(); }
+
+        /**
+         * @return the index of the next point.
+         */
+
+        ullint_t position() const noexcept { return pos_; }
+
+        /**
+         * @param ind the index of the next point.
+         */
+
+        void seek(const ullint_t ind);
+
+        /**
+         * @param n_points the number of points to skip.
+         */
+
+        void discard(const ullint_t n_points) { seek(pos_ + n_points); }
+
+        /**
+         * @param vals_out a pointer to n_points * dim() values in (0,1); the j-th coordinate of the i-th
+         * point is written to vals_out[i*dim() + j].
+         * @param n_points the number of points to generate.
+         */
+
+        template<typename T>
+        void fill(T* vals_out, const ullint_t n_points);
+
+    private:
+        ullint_t pos_ = 0;
+
+        std::vector<ullint_t> dir_;   // 64 direction numbers per dimension: dir_[j*64 + k] for Gray-code bit k
+        std::vector<ullint_t> shift_; // digital shift, i.e., the (scrambled) origin
+        std::vector<ullint_t> state_; // the point at index pos_
+};
+
+#include "sobol_seq.ipp"
+
+#endif
@@ -0,0 +1,217 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sobol sequence: direction numbers of Joe and Kuo (2008), Gray-code ordering
+ */
+
+namespace internal
+{
+
+// primitive polynomial (degree s, inner coefficients a) and initial direction numbers m_1, ..., m_s
+// for dimensions 2 to 21; the first dimension is the van der Corput sequence
+
+struct sobol_poly_t
+{
+    unsigned s;
+    unsigned a;
+    unsigned m[7];
+};
+
+statslib_inline
+const sobol_poly_t*
+sobol_poly_table()
+noexcept
+{
+    static const sobol_poly_t table[] = {
+        {1,  0, {1}},
+        {2,  1, {1, 3}},
+        {3,  1, {1, 3, 1}},
+        {3,  2, {1, 1, 1}},
+        {4,  1, {1, 1, 3, 3}},
+        {4,  4, {1, 3, 5, 13}},
+        {5,  2, {1, 1, 5, 5, 17}},
+        {5,  4, {1, 1, 5, 5, 5}},
+        {5,  7, {1, 1, 7, 11, 19}},
+        {5, 11, {1, 1, 5, 1, 1}},
+        {5, 13, {1, 1, 1, 3, 11}},
+        {5, 14, {1, 3, 5, 5, 31}},
+        {6,  1, {1, 3, 3, 9, 7, 49}},
+        {6, 13, {1, 1, 1, 15, 21, 21}},
+        {6, 16, {1, 3, 1, 13, 27, 49}},
+        {6, 19, {1, 1, 1, 15, 7, 5}},
+        {6, 22, {1, 3, 1, 15, 13, 25}},
+        {6, 25, {1, 1, 5, 5, 19, 61}},
+        {7,  1, {1, 3, 7, 11, 23, 15, 103}},
+        {7,  4, {1, 3, 7, 13, 13, 15, 69}}
+    };
+
+    return table;
+}
+
+// parity of the set bits of x
+
+statslib_inline
+ullint_t
+bit_parity(ullint_t x)
+noexcept
+{
+    x ^= x >> 32;
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+
+    return x & ullint_t(1);
+}
+
+}
+
+//
+
+statslib_inline
+sobol_seq::sobol_seq(const ullint_t dim_val, const bool scramble, const ullint_t seed_val)
+{
+    if (dim_val == ullint_t(0) || dim_val > max_dim()) {
+        return;
+    }
+
+    // direction number k of each dimension is m_{k+1} / 2^{k+1}, stored in the top k+1 bits
+
+    dir_.resize(dim_val * 64U);
+
+    for (ullint_t k = 0U; k < 64U; ++k) {
+        dir_[k] = ullint_t(1) << (63U - k);
+    }
+
+    for (ullint_t j = 1U; j < dim_val; ++j)
+    {
+        const internal::sobol_poly_t& poly = internal::sobol_poly_table()[j-1];
+        ullint_t* v = &dir_[j*64U];
+
+        for (ullint_t k = 0U; k < poly.s; ++k) {
+            v[k] = ullint_t(poly.m[k]) << (63U - k);
+        }
+
+        for (ullint_t k = poly.s; k < 64U; ++k)
+        {
+            v[k] = v[k - poly.s] ^ (v[k - poly.s] >> poly.s);
+
+            for (ullint_t i = 1U; i < poly.s; ++i)
+            {
+                if ((poly.a >> (poly.s - 1U - i)) & 1U) {
+                    v[k] ^= v[k-i];
+                }
+            }
+        }
+    }
+
+    //
+
+    shift_.assign(dim_val, ullint_t(0));
+
+    if (scramble)
+    {
+        // the scramble is linear in the digits, so it is applied once, to the direction numbers;
+        // row i of the lower-triangular matrix sets output bit 63-i from input bits 63-i and above
+
+        rand_engine_t engine(seed_val);
+
+        ullint_t scramble_rows[64];
+
+        for (ullint_t j = 0U; j < dim_val; ++j)
+        {
+            for (ullint_t i = 0U; i < 64U; ++i)
+            {
+                const ullint_t bit_i = ullint_t(1) << (63U - i);
+                scramble_rows[i] = bit_i | (internal::rand_u64(engine) & ~((bit_i << 1) - ullint_t(1)));
+            }
+
+            ullint_t* v = &dir_[j*64U];
+
+            for (ullint_t k = 0U; k < 64U; ++k)
+            {
+                ullint_t v_scrambled = 0U;
+
+                for (ullint_t i = 0U; i < 64U; ++i) {
+                    v_scrambled |= internal::bit_parity(scramble_rows[i] & v[k]) << (63U - i);
+                }
+
+                v[k] = v_scrambled;
+            }
+
+            shift_[j] = internal::rand_u64(engine);
+        }
+    }
+
+    seek(0U);
+}
+
+statslib_inline
+void
+sobol_seq::seek(const ullint_t ind)
+{
+    const ullint_t d = dim();
+    const ullint_t gray_ind = ind ^ (ind >> 1);
+
+    state_ = shift_;
+
+    for (ullint_t k = 0U; k < 64U; ++k)
+    {
+        if ((gray_ind >> k) & 1U)
+        {
+            for (ullint_t j = 0U; j < d; ++j) {
+                state_[j] ^= dir_[j*64U + k];
+            }
+        }
+    }
+
+    pos_ = ind;
+}
+
+template<typename T>
+statslib_inline
+void
+sobol_seq::fill(T* vals_out, const ullint_t n_points)
+{
+    const ullint_t d = dim();
+
+    for (ullint_t i = 0U; i < n_points; ++i)
+    {
+        for (ullint_t j = 0U; j < d; ++j) {
+            vals_out[i*d + j] = internal::u64_to_unit_oo<T>(state_[j]);
+        }
+
+        // the next point in Gray-code order differs by the direction number of the lowest zero bit of pos_
+
+        ullint_t k = 0U;
+
+        for (ullint_t pos_bits = pos_; (pos_bits & 1U) && k < 63U; pos_bits >>= 1) {
+            ++k;
+        }
+
+        for (ullint_t j = 0U; j < d; ++j) {
+            state_[j] ^= dir_[j*64U + k];
+        }
+
+        ++pos_;
+    }
+}
@@ -0,0 +1,202 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Ziggurat method of Marsaglia and Tsang (2000)
+ *
+ * The layer tables are built once, on first use, from the (r, v) pair
+ * of each distribution (standard normal and standard exponential). Each draw uses one 64-bit word in the common case:
+ * the low bits select a layer (and sign) and the top 53 bits the position.
+ */
+
+#ifndef _statslib_ziggurat_HPP
+#define _statslib_ziggurat_HPP
+
+namespace internal
+{
+
+//
+// x[0] is the width of the base strip (rectangle plus tail, divided by f(r)),
+// x[1] = r, and x[n_layers] = 0; f[i] = f(x[i])
+
+template<typename zT>
+struct zig_tables
+{
+    double x[zT::n_layers + 1];
+    double f[zT::n_layers + 1];
+
+    zig_tables()
+    {
+        x[0] = zT::v / zT::density(zT::r);
+        x[1] = zT::r;
+
+        for (ullint_t i = 2; i < zT::n_layers; ++i) {
+            x[i] = zT::next_x(x[i-1]);
+        }
+
+        x[zT::n_layers] = 0.0;
+
+        for (ullint_t i = 0; i <= zT::n_layers; ++i) {
+            f[i] = zT::density(x[i]);
+        }
+    }
+};
+
+// thread-safe initialization on first call
+
+template<typename zT>
+statslib_inline
+const zig_tables<zT>&
+zig_get_tables()
+{
+    static const zig_tables<zT> tables;
+    return tables;
+}
+
+//
+// standard normal: 128 layers
+
+struct zig_norm_spec
+{
+    static constexpr ullint_t n_layers = 128;
+
+    static constexpr double r = 3.442619855899;
+    static constexpr double v = 9.91256303526217e-3;
+
+    static double density(const double x) noexcept
+    {
+        return stmath::exp(- x * x / 2.0);
+    }
+
+    static double next_x(const double x) noexcept
+    {
+        return stmath::sqrt( - 2.0 * stmath::log(v / x + density(x)) );
+    }
+};
+
+// tail beyond r (Marsaglia, 1964)
+
+statslib_inline
+double
+zig_norm_tail(rand_engine_t& engine)
+{
+    double a = 0, b = 0;
+
+    do {
+        a = - stmath::log(u64_to_unit_oo(rand_u64(engine))) / zig_norm_spec::r;
+        b = - stmath::log(u64_to_unit_oo(rand_u64(engine)));
+    } while (b + b < a * a);
+
+    return zig_norm_spec::r + a;
+}
+
+template<typename T = double>
+statslib_inline
+T
+zig_norm(rand_engine_t& engine)
+{
+    const zig_tables<zig_norm_spec>& tab = zig_get_tables<zig_norm_spec>();
+
+    while (true) {
+        const ullint_t bits = rand_u64(engine);
+
+        const ullint_t i = bits & ullint_t(127);
+        const double sign_val = (bits & ullint_t(128)) ? -1.0 : 1.0;
+
+        const double x = u64_to_unit_co(bits) * tab.x[i];
+
+        if (x < tab.x[i+1]) {
+            return static_cast<T>(sign_val * x);
+        }
+
+        if (i == ullint_t(0)) {
+            return static_cast<T>(sign_val * zig_norm_tail(engine));
+        }
+
+        // wedge
+
+        const double y = tab.f[i] + u64_to_unit_co(rand_u64(engine)) * (tab.f[i+1] - tab.f[i]);
+
+        if (y < stmath::exp(- x * x / 2.0)) {
+            return static_cast<T>(sign_val * x);
+        }
+    }
+}
+
+//
+// standard exponential: 256 layers
+
+struct zig_exp_spec
+{
+    static constexpr ullint_t n_layers = 256;
+
+    static constexpr double r = 7.69711747013104972;
+    static constexpr double v = 3.949659822581572e-3;
+
+    static double density(const double x) noexcept
+    {
+        return stmath::exp(- x);
+    }
+
+    static double next_x(const double x) noexcept
+    {
+        return - stmath::log(v / x + density(x));
+    }
+};
+
+template<typename T = double>
+statslib_inline
+T
+zig_exp(rand_engine_t& engine)
+{
+    const zig_tables<zig_exp_spec>& tab = zig_get_tables<zig_exp_spec>();
+
+    double tail_val = 0;
+
+    while (true) {
+        const ullint_t bits = rand_u64(engine);
+
+        const ullint_t i = bits & ullint_t(255);
+
+        const double x = u64_to_unit_co(bits) * tab.x[i];
+
+        if (x < tab.x[i+1]) {
+            return static_cast<T>(tail_val + x);
+        }
+
+        if (i == ullint_t(0)) {
+            // memoryless tail: shift by r and draw again
+            tail_val += zig_exp_spec::r;
+            continue;
+        }
+
+        // wedge
+
+        const double y = tab.f[i] + u64_to_unit_co(rand_u64(engine)) * (tab.f[i+1] - tab.f[i]);
+
+        if (y < stmath::exp(- x)) {
+            return static_cast<T>(tail_val + x);
+        }
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,224 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Calibration of the per-element cost table used to size OpenMP work (see omp_cost.hpp)
+ */
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "../stats_tests.hpp"
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+
+// serial nanoseconds per element of fn(), which processes n_elem elements: fn is repeated until the calls
+// take at least 20 ms in total, so the inputs, and hence the cost per element, do not depend on the timer
+
+double
+cost_ns(const std::function<void()>& fn, const int n_elem)
+{
+    long long n_calls = 0;
+    double run_ns = 0.0;
+
+    const auto t_begin = std::chrono::steady_clock::now();
+
+    while (run_ns < 2.0e07)
+    {
+        fn();
+        ++n_calls;
+
+        run_ns = std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now() - t_begin).count();
+    }
+
+    return run_ns / (static_cast<double>(n_calls) * n_elem);
+}
+
+void
+print_cost(const std::string& kernel_name, const double kernel_ns)
+{
+    const long long kernel_ns_int = kernel_ns < 1.0 ? 1 : std::llround(kernel_ns);
+
+    std::cout << "#define STATS_OMP_COST_" << std::left << std::setw(20) << kernel_name 
+              << "ullint_t(" << kernel_ns_int << ")" << std::endl;
+}
+
+// fixed grid of n_grid points on (a,b); integer-valued for discrete distributions
+
+const int n_grid = 1000;
+
+std::vector<double>
+grid(const double a, const double b, const bool is_discrete = false)
+{
+    std::vector<double> x(n_grid);
+
+    for (int i = 0; i < n_grid; ++i) {
+        x[i] = a + (b - a) * (i + 0.5) / n_grid;
+        x[i] = is_discrete ? std::floor(x[i]) : x[i];
+    }
+
+    return x;
+}
+
+#define COST_EVAL(kernel, a, b, is_discrete, ...)                                       \
+{                                                                                       \
+    const std::vector<double> x = grid(a,b,is_discrete);                                \
+    print_cost(#kernel, cost_ns([&]() {                                                 \
+        vals_out = stats::kernel(x,__VA_ARGS__); }, n_grid));                           \
+}
+
+#define COST_RAND(kernel_name, rand_fn, ...)                                            \
+    print_cost(kernel_name, cost_ns([&]() {                                             \
+        vals_out = stats::rand_fn<std::vector<double>>(n_grid,1,__VA_ARGS__,engine); }, n_grid));
+
+#define COST_RAND_MODE(kernel_name, rand_fn, ...)                                       \
+    print_cost(kernel_name, cost_ns([&]() {                                             \
+        vals_out = stats::rand_fn<std::vector<double>>(n_grid,1,__VA_ARGS__,engine,     \
+                                                      stats::rand_mode::antithetic); }, n_grid));
+
+int main()
+{
+    print_begin("omp_cost");
+
+#ifdef STATS_USE_OPENMP
+    omp_set_num_threads(1);
+#endif
+
+    std::vector<double> vals_out;
+    stats::rand_engine_t engine(1776);
+
+    // density functions
+
+    COST_EVAL(dbern, 0, 2, true, 0.4);
+    COST_EVAL(dbeta, 0, 1, false, 2.0, 3.0);
+    COST_EVAL(dbinom, 0, 11, true, 10, 0.4);
+    COST_EVAL(dcauchy, -10, 10, false, 0.0, 1.0);
+    COST_EVAL(dchisq, 0, 20, false, 3.0);
+    COST_EVAL(dexp, 0, 5, false, 2.0);
+    COST_EVAL(df, 0, 10, false, 3.0, 5.0);
+    COST_EVAL(dgamma, 0, 20, false, 2.5, 1.5);
+    COST_EVAL(dinvgamma, 0, 5, false, 2.5, 1.5);
+    COST_EVAL(dinvgauss, 0, 5, false, 1.0, 2.0);
+    COST_EVAL(dlaplace, -10, 10, false, 0.0, 1.0);
+    COST_EVAL(dlnorm, 0, 10, false, 0.0, 1.0);
+    COST_EVAL(dlogis, -10, 10, false, 0.0, 1.0);
+    COST_EVAL(dnorm, -5, 5, false, 0.0, 1.0);
+    COST_EVAL(dpois, 0, 20, true, 4.0);
+    COST_EVAL(dradem, -1, 2, true, 0.5);
+    COST_EVAL(dt, -10, 10, false, 5.0);
+    COST_EVAL(dunif, 0, 1, false, 0.0, 1.0);
+    COST_EVAL(dweibull, 0, 5, false, 2.0, 1.0);
+
+    // distribution functions
+
+    COST_EVAL(pbern, 0, 2, true, 0.4);
+    COST_EVAL(pbeta, 0, 1, false, 2.0, 3.0);
+    COST_EVAL(pbinom, 0, 11, true, 10, 0.4);
+    COST_EVAL(pcauchy, -10, 10, false, 0.0, 1.0);
+    COST_EVAL(pchisq, 0, 20, false, 3.0);
+    COST_EVAL(pexp, 0, 5, false, 2.0);
+    COST_EVAL(pf, 0, 10, false, 3.0, 5.0);
+    COST_EVAL(pgamma, 0, 20, false, 2.5, 1.5);
+    COST_EVAL(pinvgamma, 0, 5, false, 2.5, 1.5);
+    COST_EVAL(pinvgauss, 0, 5, false, 1.0, 2.0);
+    COST_EVAL(plaplace, -10, 10, false, 0.0, 1.0);
+    COST_EVAL(plnorm, 0, 10, false, 0.0, 1.0);
+    COST_EVAL(plogis, -10, 10, false, 0.0, 1.0);
+    COST_EVAL(pnorm, -5, 5, false, 0.0, 1.0);
+    COST_EVAL(ppois, 0, 20, true, 4.0);
+    COST_EVAL(pradem, -1, 2, true, 0.5);
+    COST_EVAL(pt, -10, 10, false, 5.0);
+    COST_EVAL(punif, 0, 1, false, 0.0, 1.0);
+    COST_EVAL(pweibull, 0, 5, false, 2.0, 1.0);
+
+    // quantile functions
+
+    COST_EVAL(qbern, 0, 1, false, 0.4);
+    COST_EVAL(qbeta, 0, 1, false, 2.0, 3.0);
+    COST_EVAL(qbinom, 0, 1, false, 10, 0.4);
+    COST_EVAL(qcauchy, 0, 1, false, 0.0, 1.0);
+    COST_EVAL(qchisq, 0, 1, false, 3.0);
+    COST_EVAL(qexp, 0, 1, false, 2.0);
+    COST_EVAL(qf, 0, 1, false, 3.0, 5.0);
+    COST_EVAL(qgamma, 0, 1, false, 2.5, 1.5);
+    COST_EVAL(qinvgamma, 0, 1, false, 2.5, 1.5);
+    COST_EVAL(qinvgauss, 0, 1, false, 1.0, 2.0);
+    COST_EVAL(qlaplace, 0, 1, false, 0.0, 1.0);
+    COST_EVAL(qlnorm, 0, 1, false, 0.0, 1.0);
+    COST_EVAL(qlogis, 0, 1, false, 0.0, 1.0);
+    COST_EVAL(qnorm, 0, 1, false, 0.0, 1.0);
+    COST_EVAL(qpois, 0, 1, false, 4.0);
+    COST_EVAL(qradem, 0, 1, false, 0.5);
+    COST_EVAL(qt, 0, 1, false, 5.0);
+    COST_EVAL(qunif, 0, 1, false, 0.0, 1.0);
+    COST_EVAL(qweibull, 0, 1, false, 2.0, 1.0);
+
+    // random sampling, named after the per-draw kernel of each sampler
+
+    const stats::alias_table table(std::vector<double>{0.1, 0.2, 0.3, 0.4});
+
+    COST_RAND("rbern", rbern, 0.4);
+    COST_RAND("rbeta_draw", rbeta, 2.0, 3.0);
+    COST_RAND("rbinom_draw", rbinom, 10, 0.4);
+    COST_RAND("rcauchy_from_unit", rcauchy, 0.0, 1.0);
+    COST_RAND("rchisq_draw", rchisq, 3.0);
+    COST_RAND("rdiscrete_draw", rdiscrete, table);
+    COST_RAND("rexp_vec_compute", rexp, 2.0);
+    COST_RAND_MODE("rexp_from_unit", rexp, 2.0);
+    COST_RAND("rf_draw", rf, 3.0, 5.0);
+    COST_RAND("rgamma_draw", rgamma, 2.5, 1.5);
+    COST_RAND("rinvgamma", rinvgamma, 2.5, 1.5);
+    COST_RAND("rinvgauss", rinvgauss, 1.0, 2.0);
+    COST_RAND("rlaplace_from_unit", rlaplace, 0.0, 1.0);
+    COST_RAND("rlnorm", rlnorm, 0.0, 1.0);
+    COST_RAND("rlogis_from_unit", rlogis, 0.0, 1.0);
+    COST_RAND("rnorm_vec_compute", rnorm, 0.0, 1.0);
+    COST_RAND_MODE("rnorm_from_unit", rnorm, 0.0, 1.0);
+    COST_RAND("rpois_draw", rpois, 4.0);
+    COST_RAND("rradem", rradem, 0.5);
+    COST_RAND("rt_draw", rt, 5.0);
+    COST_RAND("runif_from_unit", runif, 0.0, 1.0);
+    COST_RAND("rweibull_from_unit", rweibull, 2.0, 1.0);
+
+    // seeding one engine stream per thread
+
+    print_cost("stream_engine", cost_ns([&]() {
+        for (int i = 0; i < n_grid; ++i) {
+            engine = stats::stream_engine(1776,i);
+        } }, n_grid));
+
+    //
+
+    std::cout << "\n*** omp_cost: end tests. ***\n" << std::endl;
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << "omp_cost: requires std::vector wrappers (./configure -s)" << std::endl;
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,138 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * OpenMP thread scaling of vector evaluation and sampling
+ */
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "../stats_tests.hpp"
+
+#if defined(STATS_TEST_STDVEC_FEATURES) && defined(STATS_USE_OPENMP)
+
+// best of n_reps wall-clock times, in milliseconds
+
+double
+time_ms(const std::function<void()>& fn, const int n_reps = 3)
+{
+    double best_ms = -1;
+
+    for (int r = 0; r < n_reps; ++r) {
+        const auto t_begin = std::chrono::steady_clock::now();
+        fn();
+        const auto t_end = std::chrono::steady_clock::now();
+
+        const double run_ms = std::chrono::duration<double,std::milli>(t_end - t_begin).count();
+        best_ms = (best_ms < 0 || run_ms < best_ms) ? run_ms : best_ms;
+    }
+
+    return best_ms;
+}
+
+void
+print_scaling(const std::string& fn_name, const int n_elem, const std::vector<int>& thread_counts, const std::function<void()>& fn)
+{
+    std::cout << fn_name << ", n = " << n_elem << "\n";
+
+    double serial_ms = 0;
+
+    for (int n_threads : thread_counts)
+    {
+        omp_set_num_threads(n_threads);
+
+        const double run_ms = time_ms(fn);
+        serial_ms = (n_threads == 1) ? run_ms : serial_ms;
+
+        std::cout << "    threads: " << std::setw(3) << n_threads 
+                  << "    time (ms): " << std::setw(10) << std::fixed << std::setprecision(3) << run_ms 
+                  << "    speedup: " << std::setprecision(2) << serial_ms / run_ms << std::endl;
+    }
+
+    std::cout << std::defaultfloat;
+}
+
+int main()
+{
+    print_begin("omp_scaling");
+
+    //
+
+    std::vector<int> thread_counts;
+
+    const int max_threads = omp_get_max_threads();
+
+    for (int n_threads = 1; n_threads < max_threads; n_threads *= 2) {
+        thread_counts.push_back(n_threads);
+    }
+
+    thread_counts.push_back(max_threads);
+
+    //
+
+    const int n_dens = 1 << 21;
+    const int n_prob = 1 << 14;
+    const int n_quant = 1 << 9;
+    const int n_rand = 1 << 21;
+
+    std::vector<double> x_dens(n_dens), x_prob(n_prob), p_quant(n_quant);
+
+    for (int i = 0; i < n_dens; ++i) {
+        x_dens[i] = -5.0 + 10.0 * (i + 0.5) / n_dens;
+    }
+
+    for (int i = 0; i < n_prob; ++i) {
+        x_prob[i] = 20.0 * (i + 0.5) / n_prob;
+    }
+
+    // quantiles have a variable cost per element: the number of iterations grows in the tails
+
+    for (int i = 0; i < n_quant; ++i) {
+        p_quant[i] = (i + 0.5) / n_quant;
+    }
+
+    std::vector<double> vals_out;
+    stats::rand_engine_t engine(1776);
+
+    print_scaling("dnorm", n_dens, thread_counts, [&]() { vals_out = stats::dnorm(x_dens,0.0,1.0); });
+    print_scaling("pgamma", n_prob, thread_counts, [&]() { vals_out = stats::pgamma(x_prob,2.5,1.5); });
+    print_scaling("qgamma", n_quant, thread_counts, [&]() { vals_out = stats::qgamma(p_quant,2.5,1.5); });
+    print_scaling("rnorm", n_rand, thread_counts, [&]() { vals_out = stats::rnorm<std::vector<double>>(n_rand,1,0.0,1.0,engine); });
+    print_scaling("rgamma", n_rand, thread_counts, [&]() { vals_out = stats::rgamma<std::vector<double>>(n_rand,1,2.5,1.5,engine); });
+
+    //
+
+    std::cout << "\n*** omp_scaling: end tests. ***\n" << std::endl;
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << "omp_scaling: requires std::vector wrappers and OpenMP (./configure -p -s)" << std::endl;
+
+    return 0;
+}
+
+#endif
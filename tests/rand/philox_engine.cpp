@@ -0,0 +1,90 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#ifndef STATS_RNG_ENGINE_TYPE
+    #define STATS_RNG_ENGINE_TYPE stats::philox_engine
+#endif
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("philox_engine");
+
+    //
+
+    stats::philox_engine engine(1776);
+
+    stats::philox_engine sub_1 = engine.substream(1);
+    stats::philox_engine sub_2 = engine.substream(2);
+
+    std::cout << "sibling substreams: first draws differ: " << (sub_1() != sub_2()) << ". Should be equal to: 1" << std::endl;
+
+    // grandchildren of different parents, taken at the same position, are distinct
+
+    stats::philox_engine sub_11 = engine.substream(1).substream(0);
+    stats::philox_engine sub_21 = engine.substream(2).substream(0);
+
+    std::cout << "substreams of sibling substreams differ: " << (sub_11() != sub_21()) << ". Should be equal to: 1" << std::endl;
+
+    // copies of a non-const engine continue its sequence
+
+    stats::philox_engine engine_copy(engine);
+
+    std::cout << "copied engine matches: " << (engine_copy == engine && engine_copy() == engine()) << ". Should be equal to: 1" << std::endl;
+
+    //
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::cout << "\n";
+
+    const int n_sample = 4;
+
+    sub_1 = engine.substream(1);
+    sub_2 = engine.substream(2);
+
+    std::vector<double> norm_1 = stats::rnorm<std::vector<double>>(n_sample,1,0.0,1.0,sub_1);
+    std::vector<double> norm_2 = stats::rnorm<std::vector<double>>(n_sample,1,0.0,1.0,sub_2);
+
+    std::vector<double> unif_1 = stats::runif<std::vector<double>>(n_sample,1,0.0,1.0,sub_1);
+    std::vector<double> unif_2 = stats::runif<std::vector<double>>(n_sample,1,0.0,1.0,sub_2);
+
+    bool all_differ = true;
+
+    for (int i = 0; i < n_sample; ++i) {
+        all_differ = all_differ && (norm_1[i] != norm_2[i]) && (unif_1[i] != unif_2[i]);
+    }
+
+    std::cout << "stdvec: sibling substreams give different fills: " << all_differ << ". Should be equal to: 1" << std::endl;
+
+    // the same substream, recreated, gives the same fill
+
+    stats::philox_engine sub_1b = engine.substream(1);
+
+    std::cout << "stdvec: recreated substream gives the same fill: " 
+              << (stats::rnorm<std::vector<double>>(n_sample,1,0.0,1.0,sub_1b) == norm_1) << ". Should be equal to: 1" << std::endl;
+#endif
+
+    //
+
+    std::cout << "\n*** philox_engine: end tests. ***\n" << std::endl;
+
+    return 0;
+}
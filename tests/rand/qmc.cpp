@@ -0,0 +1,97 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("qmc");
+
+    //
+
+    int n_points = 4096;
+
+    stats::sobol_seq sobol(3);
+    stats::halton_seq halton(3);
+
+    std::vector<double> unit_vals(3 * n_points);
+
+    sobol.fill(unit_vals.data(),n_points);
+
+    std::cout << "sobol point 1: (" << unit_vals[3] << ", " << unit_vals[4] << ", " << unit_vals[5] << "). Should be equal to: (0.5, 0.5, 0.5)" << std::endl;
+    std::cout << "sobol point 2: (" << unit_vals[6] << ", " << unit_vals[7] << ", " << unit_vals[8] << "). Should be equal to: (0.75, 0.25, 0.25)" << std::endl;
+
+    halton.fill(unit_vals.data(),n_points);
+
+    std::cout << "halton point 0: (" << unit_vals[0] << ", " << unit_vals[1] << ", " << unit_vals[2] << "). Should be equal to: (0.5, 0.333333, 0.2)" << std::endl;
+
+    //
+
+    stats::sobol_seq sobol_s(3,true,1776), sobol_skip(3,true,1776);
+
+    sobol_s.fill(unit_vals.data(),n_points);
+
+    std::vector<double> skip_vals(3);
+    sobol_skip.seek(1000);
+    sobol_skip.fill(skip_vals.data(),1);
+
+    std::cout << "\nscrambled sobol point 1000 after seek: " << skip_vals[1] << ". Should be equal to: " << unit_vals[3*1000 + 1] << std::endl;
+
+    //
+
+    double gamma_mean = 2.0;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::cout << "\n";
+    std::vector<double> gamma_stdvec = stats::qmc_fill<std::vector<double>>(n_points,sobol_s,[](double u){ return stats::qgamma(u,2.0,1.0); });
+
+    std::cout << "stdvec: sobol gamma mean: " << stats::mat_ops::mean(gamma_stdvec) << ". Should be close to: " << gamma_mean << std::endl;
+
+    gamma_stdvec = stats::qmc_fill<std::vector<double>>(n_points,halton,[](double u){ return stats::qgamma(u,2.0,1.0); });
+
+    std::cout << "stdvec: halton gamma mean: " << stats::mat_ops::mean(gamma_stdvec) << ". Should be close to: " << gamma_mean << std::endl;
+
+    // column-major, as for the other n x k std::vector outputs
+
+    stats::sobol_seq sobol_layout(3);
+    std::vector<double> layout_stdvec = stats::qmc_fill<std::vector<double>>(4,sobol_layout,[](double u){ return u; });
+
+    std::cout << "stdvec: sobol point 2 via qmc_fill: (" << layout_stdvec[2] << ", " << layout_stdvec[4 + 2] << ", " << layout_stdvec[8 + 2] << "). Should be equal to: (0.75, 0.25, 0.25)" << std::endl;
+#endif
+
+    //
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    std::cout << "\n";
+    mat_obj gamma_mat = stats::qmc_fill<mat_obj>(n_points,sobol_s,[](double u){ return stats::qgamma(u,2.0,1.0); });
+
+    std::cout << "Matrix: sobol gamma mean: " << stats::mat_ops::mean(gamma_mat) << ". Should be close to: " << gamma_mean << std::endl;
+
+    gamma_mat = stats::qmc_fill<mat_obj>(n_points,halton,[](double u){ return stats::qgamma(u,2.0,1.0); });
+
+    std::cout << "Matrix: halton gamma mean: " << stats::mat_ops::mean(gamma_mat) << ". Should be close to: " << gamma_mean << std::endl;
+#endif
+
+    //
+
+    std::cout << "\n*** qmc: end tests. ***\n" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#define STATS_ENABLE_RAND_PREFETCH
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("rand_prefetch");
+
+    //
+
+    double mu = 2.5;
+    double sigma = 1.5;
+
+    int n_sample = 100000;
+
+    //
+
+    std::vector<double> normal_draws(n_sample);
+    std::vector<double> unif_draws(n_sample);
+
+    {
+        stats::rand_prefetch prefetch(1776, 256);
+
+        std::cout << "ring capacity: " << prefetch.capacity() << ". Should be equal to: 256" << std::endl;
+
+        for (int i = 0; i < n_sample; ++i) {
+            normal_draws[i] = stats::rnorm(mu,sigma,prefetch);
+            unif_draws[i] = stats::runif(0.0,1.0,prefetch);
+        }
+    }
+
+    double normal_mean = 0, normal_var = 0, unif_mean = 0;
+
+    for (int i = 0; i < n_sample; ++i) {
+        normal_mean += normal_draws[i] / n_sample;
+        unif_mean += unif_draws[i] / n_sample;
+    }
+
+    for (int i = 0; i < n_sample; ++i) {
+        normal_var += (normal_draws[i] - normal_mean) * (normal_draws[i] - normal_mean) / (n_sample - 1);
+    }
+
+    std::cout << "normal rv mean: " << normal_mean << ". Should be close to: " << mu << std::endl;
+    std::cout << "normal rv variance: " << normal_var << ". Should be close to: " << sigma*sigma << std::endl;
+    std::cout << "uniform rv mean: " << unif_mean << ". Should be close to: 0.5" << std::endl;
+
+    // each stream depends only on the seed, not on how draws from the two streams are interleaved
+
+    bool same_stream = true;
+
+    {
+        stats::rand_prefetch prefetch(1776, 256);
+
+        for (int i = 0; i < n_sample; ++i) {
+            same_stream = same_stream && (stats::runif(0.0,1.0,prefetch) == unif_draws[i]);
+        }
+
+        for (int i = 0; i < n_sample; ++i) {
+            same_stream = same_stream && (stats::rnorm(mu,sigma,prefetch) == normal_draws[i]);
+        }
+    }
+
+    std::cout << "same streams with a different interleaving: " << same_stream << ". Should be equal to: 1" << std::endl;
+
+    //
+
+    std::cout << "\n*** rand_prefetch: end tests. ***\n" << std::endl;
+
+    return 0;
+}
@@ -32,6 +32,14 @@ int main()
     double binom_mean = n_trials*prob_par;
     double binom_var = n_trials*prob_par*(1.0 - prob_par);
 
+    // n*min(p,1-p) >= 30: drawn by BTPE rather than inversion
+
+    int n_trials_large = 1000;
+    double prob_par_large = 0.3;
+
+    double binom_mean_large = n_trials_large*prob_par_large;
+    double binom_var_large = n_trials_large*prob_par_large*(1.0 - prob_par_large);
+
     int n_sample = 10000;
 
     //
@@ -56,6 +64,13 @@ int main()
 
     std::cout << "stdvec (with random engine): binom rv mean: " << stats::mat_ops::mean(binom_stdvec) << ". Should be close to: " << binom_mean << std::endl;
     std::cout << "stdvec (with random engine): binom rv variance: " << stats::mat_ops::var(binom_stdvec) << ". Should be close to: " << binom_var << std::endl;
+
+    //
+
+    binom_stdvec = stats::rbinom<std::vector<double>>(n_sample,1,n_trials_large,prob_par_large,engine_s);
+
+    std::cout << "stdvec (BTPE): binom rv mean: " << stats::mat_ops::mean(binom_stdvec) << ". Should be close to: " << binom_mean_large << std::endl;
+    std::cout << "stdvec (BTPE): binom rv variance: " << stats::mat_ops::var(binom_stdvec) << ". Should be close to: " << binom_var_large << std::endl;
 #endif
 
     //
@@ -75,6 +90,13 @@ int main()
 
     std::cout << "Matrix (with random engine): binom rv mean: " << stats::mat_ops::mean(binom_vec) << ". Should be close to: " << binom_mean << std::endl;
     std::cout << "Matrix (with random engine): binom rv variance: " << stats::mat_ops::var(binom_vec) << ". Should be close to: " << binom_var << std::endl;
+
+    //
+
+    binom_vec = stats::rbinom<mat_obj>(n_sample,1,n_trials_large,prob_par_large,engine_m);
+
+    std::cout << "Matrix (BTPE): binom rv mean: " << stats::mat_ops::mean(binom_vec) << ". Should be close to: " << binom_mean_large << std::endl;
+    std::cout << "Matrix (BTPE): binom rv variance: " << stats::mat_ops::var(binom_vec) << ". Should be close to: " << binom_var_large << std::endl;
 #endif
 
     //
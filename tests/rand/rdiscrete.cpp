@@ -0,0 +1,114 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("rdiscrete");
+
+    //
+
+    std::vector<double> weights = {1.0, 2.0, 3.0, 4.0};
+
+    stats::alias_table table(weights);
+
+    double discrete_mean = (0*1.0 + 1*2.0 + 2*3.0 + 3*4.0) / 10.0;
+    double discrete_var = (0*1.0 + 1*2.0 + 4*3.0 + 9*4.0) / 10.0 - discrete_mean*discrete_mean;
+
+    int n_sample = 10000;
+
+    //
+
+    stats::ullint_t discrete_rand = stats::rdiscrete(table);
+    std::cout << "discrete rv draw: " << discrete_rand << std::endl;
+
+    // invalid weights give an empty table
+
+    stats::alias_table empty_table(std::vector<double>{1.0, -2.0});
+
+    std::cout << "alias table from invalid weights: size: " << empty_table.size() << ". Should be equal to: 0" << std::endl;
+    std::cout << "alias table from invalid weights: draw is empty_val: " << (stats::rdiscrete(empty_table) == stats::discrete_empty_val) << ". Should be equal to: 1" << std::endl;
+
+    //
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::cout << "\n";
+    std::vector<double> discrete_stdvec = stats::rdiscrete<std::vector<double>>(n_sample,1,table);
+
+    std::cout << "discrete rv mean: " << stats::mat_ops::mean(discrete_stdvec) << ". Should be close to: " << discrete_mean << std::endl;
+    std::cout << "discrete rv variance: " << stats::mat_ops::var(discrete_stdvec) << ". Should be close to: " << discrete_var << std::endl;
+
+    //
+
+    stats::rand_engine_t engine_s(1);
+
+    discrete_stdvec = stats::rdiscrete<std::vector<double>>(n_sample,1,table,engine_s);
+
+    std::cout << "stdvec (with random engine): discrete rv mean: " << stats::mat_ops::mean(discrete_stdvec) << ". Should be close to: " << discrete_mean << std::endl;
+    std::cout << "stdvec (with random engine): discrete rv variance: " << stats::mat_ops::var(discrete_stdvec) << ". Should be close to: " << discrete_var << std::endl;
+#endif
+
+    //
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    std::cout << "\n";
+    mat_obj discrete_vec = stats::rdiscrete<mat_obj>(n_sample,1,table);
+
+    std::cout << "discrete rv mean: " << stats::mat_ops::mean(discrete_vec) << ". Should be close to: " << discrete_mean << std::endl;
+    std::cout << "discrete rv variance: " << stats::mat_ops::var(discrete_vec) << ". Should be close to: " << discrete_var << std::endl;
+
+    //
+
+    stats::rand_engine_t engine_m(1);
+
+    discrete_vec = stats::rdiscrete<mat_obj>(n_sample,1,table,engine_m);
+
+    std::cout << "Matrix (with random engine): discrete rv mean: " << stats::mat_ops::mean(discrete_vec) << ". Should be close to: " << discrete_mean << std::endl;
+    std::cout << "Matrix (with random engine): discrete rv variance: " << stats::mat_ops::var(discrete_vec) << ". Should be close to: " << discrete_var << std::endl;
+#endif
+
+    // guide table (exact inversion) for the Poisson distribution
+
+    double rate_par = 4.5;
+
+    stats::guide_table pois_table = stats::guide_table::pois(rate_par);
+
+    std::cout << "\n";
+    std::cout << "guide table inverse(0.5): " << pois_table.inverse(0.5) << ". Should be equal to: " << stats::qpois(0.5,rate_par) << std::endl;
+
+    stats::guide_table empty_guide(std::vector<double>{1.0, -2.0});
+
+    std::cout << "guide table from invalid weights: size: " << empty_guide.size() << ". Should be equal to: 0" << std::endl;
+    std::cout << "guide table from invalid weights: draw is empty_val: " << (stats::rdiscrete(empty_guide) == stats::discrete_empty_val) << ". Should be equal to: 1" << std::endl;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::vector<double> pois_stdvec = stats::rdiscrete<std::vector<double>>(n_sample,1,pois_table);
+
+    std::cout << "guide table pois rv mean: " << stats::mat_ops::mean(pois_stdvec) << ". Should be close to: " << rate_par << std::endl;
+    std::cout << "guide table pois rv variance: " << stats::mat_ops::var(pois_stdvec) << ". Should be close to: " << rate_par << std::endl;
+#endif
+
+    //
+
+    std::cout << "\n*** rdiscrete: end tests. ***\n" << std::endl;
+
+    return 0;
+}
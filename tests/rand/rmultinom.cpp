@@ -45,6 +45,7 @@ int main()
     stats::mat_ops::zeros(X,5,1);
 
     int n = 10000;
+    stats::llint_t n_trials = 100;
 
     for (int i=0; i < n; i++) {
         X += stats::rmultinom<mat_obj>(prob_vec,engine_m) / n;
@@ -53,6 +54,42 @@ int main()
     std::cout << "sample mean:\n" << X / 5.0 << std::endl;
     std::cout << "\nshould be close to:\n" << prob_vec << std::endl;
 
+    // explicit number of trials; one draw per row
+
+    mat_obj X_batch = stats::rmultinom<mat_obj>(n, n_trials, prob_vec, engine_m);
+
+    stats::mat_ops::zeros(X,5,1);
+
+    for (int i=0; i < n; i++) {
+        for (int j=0; j < 5; j++) {
+            X(j,0) += X_batch(i,j) / (n * n_trials);
+        }
+    }
+
+    std::cout << "\nsample mean (" << n_trials << " trials):\n" << X << std::endl;
+    std::cout << "\nshould be close to:\n" << prob_vec << std::endl;
+
+    // a zero-weight last category gets no trials; with these weights, p_4 / (p_4 + ... ) rounds to just below one
+
+    mat_obj prob_vec_zero(5,1);
+
+    prob_vec_zero(0,0) = 0.1;
+    prob_vec_zero(1,0) = 0.15;
+    prob_vec_zero(2,0) = 0.2;
+    prob_vec_zero(3,0) = 0.35;
+    prob_vec_zero(4,0) = 0.0;
+
+    X_batch = stats::rmultinom<mat_obj>(n, n_trials, prob_vec_zero, engine_m);
+
+    bool zero_weight_empty = true;
+
+    for (int i=0; i < n; i++) {
+        zero_weight_empty = zero_weight_empty && (X_batch(i,4) == 0.0) 
+                            && (X_batch(i,0) + X_batch(i,1) + X_batch(i,2) + X_batch(i,3) == n_trials);
+    }
+
+    std::cout << "\nzero-weight last category gets no trials: " << zero_weight_empty << ". Should be equal to: 1" << std::endl;
+
     //
 
     std::cout << "\n*** rmultinom: end tests. ***\n" << std::endl;
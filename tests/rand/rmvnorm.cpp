@@ -63,6 +63,24 @@ int main()
     std::cout << "\nmu_hat:\n" << mean_vec << std::endl;
     std::cout << "\nSigma_hat:\n" << cov_mat << std::endl;
 
+    //
+    // quasi-Monte Carlo points
+
+    stats::sobol_seq seq(K,true,1776);
+
+    mvnorm_vars = stats::rmvnorm(n,mu,Sigma,seq);
+
+    stats::mat_ops::zeros(mean_vec,1,K);
+
+    for (int i=0; i < n; i++) {
+        mean_vec = mean_vec + stats::mat_ops::get_row(mvnorm_vars,i);
+    }
+
+    mean_vec = mean_vec * (1.0 / static_cast<double>(n));
+    mean_vec = stats::mat_ops::trans(mean_vec);
+
+    std::cout << "\nmu_hat (sobol):\n" << mean_vec << std::endl;
+
     //
     // coverage tests
 
@@ -75,6 +75,18 @@ int main()
 
     std::cout << "Matrix (with random engine): normal rv mean: " << stats::mat_ops::mean(normal_vec) << ". Should be close to: " << normal_mean << std::endl;
     std::cout << "Matrix (with random engine): normal rv variance: " << stats::mat_ops::var(normal_vec) << ". Should be close to: " << normal_var << std::endl;
+
+    //
+
+    normal_vec = stats::rnorm<mat_obj>(n_sample,1,mu,sigma,engine_m,stats::rand_mode::antithetic);
+
+    std::cout << "Matrix (antithetic): normal rv mean: " << stats::mat_ops::mean(normal_vec) << ". Should be close to: " << normal_mean << std::endl;
+    std::cout << "Matrix (antithetic): normal rv variance: " << stats::mat_ops::var(normal_vec) << ". Should be close to: " << normal_var << std::endl;
+
+    normal_vec = stats::rnorm<mat_obj>(n_sample,1,mu,sigma,engine_m,stats::rand_mode::stratified);
+
+    std::cout << "Matrix (stratified): normal rv mean: " << stats::mat_ops::mean(normal_vec) << ". Should be close to: " << normal_mean << std::endl;
+    std::cout << "Matrix (stratified): normal rv variance: " << stats::mat_ops::var(normal_vec) << ". Should be close to: " << normal_var << std::endl;
 #endif
 
     //
@@ -31,6 +31,13 @@ int main()
     double pois_mean = rate_par;
     double pois_var = rate_par;
 
+    // rate_par >= 10: drawn by PTRS rather than inversion
+
+    double rate_par_large = 50.0;
+
+    double pois_mean_large = rate_par_large;
+    double pois_var_large = rate_par_large;
+
     int n_sample = 10000;
 
     //
@@ -55,6 +62,13 @@ int main()
 
     std::cout << "stdvec (with random engine): pois rv mean: " << stats::mat_ops::mean(pois_stdvec) << ". Should be close to: " << pois_mean << std::endl;
     std::cout << "stdvec (with random engine): pois rv variance: " << stats::mat_ops::var(pois_stdvec) << ". Should be close to: " << pois_var << std::endl;
+
+    //
+
+    pois_stdvec = stats::rpois<std::vector<double>>(n_sample,1,rate_par_large,engine_s);
+
+    std::cout << "stdvec (PTRS): pois rv mean: " << stats::mat_ops::mean(pois_stdvec) << ". Should be close to: " << pois_mean_large << std::endl;
+    std::cout << "stdvec (PTRS): pois rv variance: " << stats::mat_ops::var(pois_stdvec) << ". Should be close to: " << pois_var_large << std::endl;
 #endif
 
     //
@@ -74,6 +88,13 @@ int main()
 
     std::cout << "Matrix (with random engine): pois rv mean: " << stats::mat_ops::mean(pois_vec) << ". Should be close to: " << pois_mean << std::endl;
     std::cout << "Matrix (with random engine): pois rv variance: " << stats::mat_ops::var(pois_vec) << ". Should be close to: " << pois_var << std::endl;
+
+    //
+
+    pois_vec = stats::rpois<mat_obj>(n_sample,1,rate_par_large,engine_m);
+
+    std::cout << "Matrix (PTRS): pois rv mean: " << stats::mat_ops::mean(pois_vec) << ". Should be close to: " << pois_mean_large << std::endl;
+    std::cout << "Matrix (PTRS): pois rv variance: " << stats::mat_ops::var(pois_vec) << ". Should be close to: " << pois_var_large << std::endl;
 #endif
 
     //
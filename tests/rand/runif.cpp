@@ -56,6 +56,59 @@ int main()
 
     std::cout << "stdvec (with random engine): unif rv mean: " << stats::mat_ops::mean(unif_stdvec) << ". Should be close to: " << unif_mean << std::endl;
     std::cout << "stdvec (with random engine): unif rv variance: " << stats::mat_ops::var(unif_stdvec) << ". Should be close to: " << unif_var << std::endl;
+
+    // a + (b - a) u rounds to an endpoint for u close to 0 or 1 in single precision; draws stay inside (a,b)
+
+    const int n_float = 20000000;
+
+    std::vector<float> unif_float = stats::runif<std::vector<float>>(n_float,1,1.0f,2.0f,engine_s);
+
+    bool float_in_open = true;
+
+    for (int i = 0; i < n_float; ++i) {
+        float_in_open = float_in_open && (unif_float[i] > 1.0f) && (unif_float[i] < 2.0f);
+    }
+
+    std::cout << "stdvec (float): no draw equals a or b: " << float_in_open << ". Should be equal to: 1" << std::endl;
+
+    // antithetic: row i + n/2 is 1 - (row i), in every column
+
+    const int n_mode = 1000;
+    const int k_mode = 3;
+
+    std::vector<double> mode_stdvec = stats::runif<std::vector<double>>(n_mode,k_mode,0.0,1.0,engine_s,stats::rand_mode::antithetic);
+
+    bool pairs_match = true;
+
+    for (int j = 0; j < k_mode; ++j) {
+        for (int i = 0; i < n_mode / 2; ++i) {
+            pairs_match = pairs_match && (mode_stdvec[j*n_mode + i] + mode_stdvec[j*n_mode + i + n_mode/2] == 1.0);
+        }
+    }
+
+    std::cout << "stdvec (antithetic): all pairs sum to one: " << pairs_match << ". Should be equal to: 1" << std::endl;
+
+    // stratified: each stratum [s/n, (s+1)/n) holds exactly one value per column
+
+    mode_stdvec = stats::runif<std::vector<double>>(n_mode,k_mode,0.0,1.0,engine_s,stats::rand_mode::stratified);
+
+    bool one_per_stratum = true;
+
+    for (int j = 0; j < k_mode; ++j)
+    {
+        std::vector<int> stratum_count(n_mode, 0);
+
+        for (int i = 0; i < n_mode; ++i) {
+            const int s = static_cast<int>(mode_stdvec[j*n_mode + i] * n_mode);
+            ++stratum_count[std::min(s, n_mode - 1)];
+        }
+
+        for (int s = 0; s < n_mode; ++s) {
+            one_per_stratum = one_per_stratum && (stratum_count[s] == 1);
+        }
+    }
+
+    std::cout << "stdvec (stratified): one value per stratum in each column: " << one_per_stratum << ". Should be equal to: 1" << std::endl;
 #endif
 
     //
@@ -0,0 +1,108 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#ifndef STATS_USE_THREAD_LOCAL_ENGINE
+    #define STATS_USE_THREAD_LOCAL_ENGINE
+#endif
+
+#include <thread>
+
+#include "../stats_tests.hpp"
+
+// draws from the default engine of the calling thread
+
+std::vector<double>
+default_draws(const int n_draws)
+{
+    std::vector<double> vals(n_draws);
+
+    for (int i = 0; i < n_draws; ++i) {
+        vals[i] = stats::runif(0.0,1.0);
+    }
+
+    return vals;
+}
+
+int main()
+{
+    print_begin("thread_local_engine");
+
+    //
+
+    const int n_draws = 8;
+
+    // reseeding gives a repeatable sequence
+
+    stats::seed_thread_local_engine(1776);
+    std::vector<double> draws_1 = default_draws(n_draws);
+
+    stats::seed_thread_local_engine(1776);
+    std::vector<double> draws_2 = default_draws(n_draws);
+
+    std::cout << "reseeded engine repeats its sequence: " << (draws_1 == draws_2) << ". Should be equal to: 1" << std::endl;
+
+    stats::rand_engine_t engine_ref(1776);
+    double unif_ref = stats::runif(0.0,1.0,engine_ref);
+
+    std::cout << "reseeded engine matches a fresh engine: " << (draws_1[0] == unif_ref) << ". Should be equal to: 1" << std::endl;
+
+    // each thread has its own engine, with its own stream
+
+    std::vector<double> thread_draws_1, thread_draws_2;
+
+    std::thread thread_1([&](){ thread_draws_1 = default_draws(n_draws); });
+    std::thread thread_2([&](){ thread_draws_2 = default_draws(n_draws); });
+
+    thread_1.join();
+    thread_2.join();
+
+    std::cout << "\n";
+    std::cout << "two threads draw different streams: " << (thread_draws_1 != thread_draws_2) << ". Should be equal to: 1" << std::endl;
+
+    // seeding in one thread leaves the others alone
+
+    stats::seed_thread_local_engine(1776);
+
+    std::vector<double> thread_draws_3;
+    std::thread thread_3([&](){ thread_draws_3 = default_draws(n_draws); });
+    thread_3.join();
+
+    std::cout << "a new thread does not share the main thread's seed: " << (thread_draws_3 != default_draws(n_draws)) << ". Should be equal to: 1" << std::endl;
+
+    //
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::cout << "\n";
+
+    stats::seed_thread_local_engine(1776);
+    std::vector<double> norm_stdvec_1 = stats::rnorm<std::vector<double>>(n_draws,2,0.0,1.0);
+
+    stats::seed_thread_local_engine(1776);
+    std::vector<double> norm_stdvec_2 = stats::rnorm<std::vector<double>>(n_draws,2,0.0,1.0);
+
+    std::cout << "stdvec: reseeded engine repeats its fill: " << (norm_stdvec_1 == norm_stdvec_2) << ". Should be equal to: 1" << std::endl;
+#endif
+
+    //
+
+    std::cout << "\n*** thread_local_engine: end tests. ***\n" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2023 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#ifndef STATS_USE_THREAD_POOL
+    #define STATS_USE_THREAD_POOL
+#endif
+
+#undef STATS_THREAD_POOL_SIZE
+#define STATS_THREAD_POOL_SIZE 4
+
+#include <stdexcept>
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("thread_pool");
+
+    //
+
+    stats::internal::thread_pool& pool = stats::internal::thread_pool::global();
+
+    std::cout << "pool size: " << pool.size() << ". Should be equal to: 4" << std::endl;
+
+    // every task runs exactly once, including tasks stolen from other ranges; a loop started
+    // from inside a task runs serially
+
+    const stats::ullint_t n_tasks = 1000;
+
+    std::vector<int> task_count(n_tasks, 0), inner_count(n_tasks, 0);
+
+    auto task_fn = [&](const stats::ullint_t j)
+    {
+        task_count[j] += 1;
+
+        auto inner_fn = [&](const stats::ullint_t) { inner_count[j] += 1; };
+        pool.run(3, 4, inner_fn);
+    };
+
+    pool.run(n_tasks, 4, task_fn);
+
+    bool all_once = true;
+
+    for (stats::ullint_t j = 0; j < n_tasks; ++j) {
+        all_once = all_once && (task_count[j] == 1) && (inner_count[j] == 3);
+    }
+
+    std::cout << "each task run once: " << all_once << ". Should be equal to: 1" << std::endl;
+
+    // an exception thrown by a task reaches the caller
+
+    bool caught = false;
+
+    try {
+        auto throw_fn = [](const stats::ullint_t j) { if (j == 37) { throw std::runtime_error("task 37"); } };
+        pool.run(100, 4, throw_fn);
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+
+    std::cout << "task exception rethrown: " << caught << ". Should be equal to: 1" << std::endl;
+
+    //
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::cout << "\n";
+
+    // quantiles have a variable cost per element, so chunks are redistributed
+
+    const int n_quant = 2000;
+
+    std::vector<double> p_vals(n_quant);
+
+    for (int i = 0; i < n_quant; ++i) {
+        p_vals[i] = (i + 0.5) / n_quant;
+    }
+
+    std::vector<double> q_vals = stats::qgamma(p_vals,2.5,1.5);
+
+    bool same_vals = true;
+
+    for (int i = 0; i < n_quant; ++i) {
+        same_vals = same_vals && (q_vals[i] == stats::qgamma(p_vals[i],2.5,1.5));
+    }
+
+    std::cout << "stdvec: qgamma matches scalar calls: " << same_vals << ". Should be equal to: 1" << std::endl;
+
+    //
+
+    double mu = 2.5;
+    double sigma = 1.5;
+
+    int n_sample = 1 << 20;
+
+    stats::rand_engine_t engine(1776);
+
+    std::vector<double> normal_stdvec = stats::rnorm<std::vector<double>>(n_sample,1,mu,sigma,engine);
+
+    std::cout << "stdvec: normal rv mean: " << stats::mat_ops::mean(normal_stdvec) << ". Should be close to: " << mu << std::endl;
+    std::cout << "stdvec: normal rv variance: " << stats::mat_ops::var(normal_stdvec) << ". Should be close to: " << sigma*sigma << std::endl;
+#endif
+
+    //
+
+    std::cout << "\n*** thread_pool: end tests. ***\n" << std::endl;
+
+    return 0;
+}